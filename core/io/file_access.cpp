@@ -37,6 +37,7 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 FileAccess::CreateFunc FileAccess::create_func[ACCESS_MAX] = {};
@@ -706,6 +707,75 @@ void FileAccess::store_csv_line(const Vector<String> &p_values, const String &p_
 	store_line(line);
 }
 
+uint64_t FileAccess::_read_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) {
+	const uint64_t position = get_position();
+	seek(p_offset);
+	const uint64_t read = get_buffer(p_dst, p_length);
+	seek(position);
+	return read;
+}
+
+void FileAccess::_async_read_task(void *p_read) {
+	AsyncRead *ar = (AsyncRead *)p_read;
+	ar->read = ar->file->_read_at(ar->offset, ar->data.ptrw(), ar->data.size());
+}
+
+FileAccess::AsyncReadID FileAccess::read_async(uint64_t p_offset, uint64_t p_length) {
+	ERR_FAIL_COND_V_MSG(!is_open(), INVALID_ASYNC_READ_ID, "File must be opened before use.");
+	ERR_FAIL_COND_V(p_length > INT32_MAX, INVALID_ASYNC_READ_ID);
+
+	AsyncRead *ar = memnew(AsyncRead);
+	ar->file = this;
+	ar->offset = p_offset;
+	ar->data.resize(p_length);
+
+	AsyncReadID id = ++last_async_read_id;
+	async_reads.insert(id, ar);
+
+	if (can_read_async() && WorkerThreadPool::get_singleton()) {
+		ar->task_id = WorkerThreadPool::get_singleton()->add_native_task(&FileAccess::_async_read_task, ar, false, String("FileAccessReadAsync"));
+	} else {
+		ar->read = _read_at(p_offset, ar->data.ptrw(), p_length);
+	}
+
+	return id;
+}
+
+bool FileAccess::is_async_read_completed(AsyncReadID p_id) const {
+	HashMap<AsyncReadID, AsyncRead *>::ConstIterator E = async_reads.find(p_id);
+	ERR_FAIL_COND_V_MSG(!E, false, "Invalid asynchronous read ID.");
+	return E->value->task_id == WorkerThreadPool::INVALID_TASK_ID || WorkerThreadPool::get_singleton()->is_task_completed(E->value->task_id);
+}
+
+Error FileAccess::wait_for_async_read(AsyncReadID p_id, Vector<uint8_t> &r_data) {
+	HashMap<AsyncReadID, AsyncRead *>::Iterator E = async_reads.find(p_id);
+	ERR_FAIL_COND_V_MSG(!E, ERR_INVALID_PARAMETER, "Invalid asynchronous read ID.");
+
+	AsyncRead *ar = E->value;
+	if (ar->task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ar->task_id);
+		ar->task_id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	const bool complete = ar->read == (uint64_t)ar->data.size();
+	r_data = ar->data;
+	r_data.resize(ar->read);
+
+	async_reads.remove(E);
+	memdelete(ar);
+
+	return complete ? OK : ERR_FILE_EOF;
+}
+
+void FileAccess::_wait_for_async_reads() {
+	for (KeyValue<AsyncReadID, AsyncRead *> &E : async_reads) {
+		if (E.value->task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(E.value->task_id);
+			E.value->task_id = WorkerThreadPool::INVALID_TASK_ID;
+		}
+	}
+}
+
 void FileAccess::store_buffer(const uint8_t *p_src, uint64_t p_length) {
 	ERR_FAIL_COND(!p_src && p_length > 0);
 	for (uint64_t i = 0; i < p_length; i++) {
@@ -853,6 +923,13 @@ String FileAccess::get_sha256(const String &p_file) {
 	return String::hex_encode_buffer(hash, 32);
 }
 
+FileAccess::~FileAccess() {
+	_wait_for_async_reads();
+	for (KeyValue<AsyncReadID, AsyncRead *> &E : async_reads) {
+		memdelete(E.value);
+	}
+}
+
 void FileAccess::_bind_methods() {
 	ClassDB::bind_static_method("FileAccess", D_METHOD("open", "path", "flags"), &FileAccess::_open);
 	ClassDB::bind_static_method("FileAccess", D_METHOD("open_encrypted", "path", "mode_flags", "key"), &FileAccess::open_encrypted);
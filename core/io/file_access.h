@@ -37,6 +37,7 @@
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
 #include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
 #include "core/typedefs.h"
 
 /**
@@ -86,6 +87,11 @@ public:
 
 	typedef void (*FileCloseFailNotify)(const String &);
 
+	typedef int64_t AsyncReadID;
+	enum {
+		INVALID_ASYNC_READ_ID = -1
+	};
+
 	typedef Ref<FileAccess> (*CreateFunc)();
 	bool big_endian = false;
 	bool real_is_double = false;
@@ -107,6 +113,13 @@ protected:
 	virtual uint64_t _get_modified_time(const String &p_file) = 0;
 	virtual void _set_access_type(AccessType p_access);
 
+	// Reads at the given position, without moving the file position. When
+	// can_read_async() is true, this is called from WorkerThreadPool threads and
+	// must be safe to run alongside other operations on the file.
+	virtual uint64_t _read_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length);
+	// Must be called before the file is closed by implementations that support asynchronous reads.
+	void _wait_for_async_reads();
+
 	static FileCloseFailNotify close_fail_notify;
 
 private:
@@ -114,6 +127,20 @@ private:
 	thread_local static Error last_file_open_error;
 
 	AccessType _access_type = ACCESS_FILESYSTEM;
+
+	struct AsyncRead {
+		FileAccess *file = nullptr;
+		uint64_t offset = 0;
+		uint64_t read = 0;
+		Vector<uint8_t> data;
+		int64_t task_id = -1;
+	};
+
+	HashMap<AsyncReadID, AsyncRead *> async_reads;
+	AsyncReadID last_async_read_id = 0;
+
+	static void _async_read_task(void *p_read);
+
 	static CreateFunc create_func[ACCESS_MAX]; /** default file access creation function for a platform */
 	template <class T>
 	static Ref<FileAccess> _create_builtin() {
@@ -188,6 +215,13 @@ public:
 
 	void store_var(const Variant &p_var, bool p_full_objects = false);
 
+	// Reads issued with read_async() run on the WorkerThreadPool when supported,
+	// otherwise they are done right away. Each one must be waited for once.
+	virtual bool can_read_async() const { return false; }
+	AsyncReadID read_async(uint64_t p_offset, uint64_t p_length);
+	bool is_async_read_completed(AsyncReadID p_id) const;
+	Error wait_for_async_read(AsyncReadID p_id, Vector<uint8_t> &r_data);
+
 	virtual void close() = 0;
 
 	virtual bool file_exists(const String &p_name) = 0; ///< return true if a file exists
@@ -233,7 +267,7 @@ public:
 	}
 
 	FileAccess() {}
-	virtual ~FileAccess() {}
+	virtual ~FileAccess();
 };
 
 VARIANT_ENUM_CAST(FileAccess::CompressionMode);
@@ -76,18 +76,125 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 
 	comp_buffer.resize(max_bs);
 	buffer.resize(block_size);
-	read_ptr = buffer.ptrw();
-	f->get_buffer(comp_buffer.ptrw(), read_blocks[0].csize);
 	at_end = false;
 	read_eof = false;
 	read_block_count = bc;
-	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
-
-	int ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
-	read_block = 0;
 	read_pos = 0;
 
-	return ret == -1 ? ERR_FILE_CORRUPT : OK;
+	return _read_block(0) ? OK : ERR_FILE_CORRUPT;
+}
+
+void FileAccessCompressed::set_read_ahead(uint32_t p_blocks) {
+	ERR_FAIL_COND_MSG(writing, "File has not been opened in read mode.");
+
+	if (!read_ahead.is_empty() && read_ptr && read_ptr != buffer.ptr()) {
+		// The current block is held by the ring, keep a copy.
+		memcpy(buffer.ptrw(), read_ptr, read_block_size);
+		read_ptr = buffer.ptr();
+	}
+	_clear_read_ahead();
+
+	if (WorkerThreadPool::get_singleton() && p_blocks > 0) {
+		// Keep at least two spans, so the next one is decompressed while the current one is read.
+		read_ahead_span_blocks = CLAMP(READ_AHEAD_SPAN_SIZE / block_size, 1u, MAX(p_blocks / 2, 1u));
+		read_ahead.resize(MAX(p_blocks / read_ahead_span_blocks, 1u));
+	}
+}
+
+void FileAccessCompressed::_decompress_span(void *p_span) {
+	ReadAheadSpan *ras = (ReadAheadSpan *)p_span;
+	const uint8_t *src = ras->comp_data.ptr();
+	uint8_t *dst = ras->data.ptrw();
+	for (uint32_t i = 0; i < ras->comp_sizes.size(); i++) {
+		if (Compression::decompress(dst, ras->block_size, src, ras->comp_sizes[i], ras->mode) == -1) {
+			return;
+		}
+		src += ras->comp_sizes[i];
+		dst += ras->block_size;
+	}
+	ras->failed = false;
+}
+
+void FileAccessCompressed::_queue_read_ahead(uint32_t p_span) const {
+	ReadAheadSpan &ras = read_ahead[p_span % read_ahead.size()];
+	const uint32_t first_block = p_span * read_ahead_span_blocks;
+	if (ras.first_block == first_block) {
+		return; // Already queued.
+	}
+
+	if (ras.task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(ras.task_id);
+		ras.task_id = WorkerThreadPool::INVALID_TASK_ID;
+	}
+
+	// Reading happens here, only decompression is done by the task. Blocks are stored
+	// one after the other, so the whole span is read at once.
+	const uint32_t block_count = MIN(read_ahead_span_blocks, read_block_count - first_block);
+	ras.first_block = first_block;
+	ras.block_size = block_size;
+	ras.mode = cmode;
+	ras.failed = true;
+	ras.comp_sizes.resize(block_count);
+	uint64_t comp_size = 0;
+	for (uint32_t i = 0; i < block_count; i++) {
+		ras.comp_sizes[i] = read_blocks[first_block + i].csize;
+		comp_size += ras.comp_sizes[i];
+	}
+	ras.comp_data.resize(comp_size);
+	ras.data.resize(block_count * block_size);
+	f->seek(read_blocks[first_block].offset);
+	if (f->get_buffer(ras.comp_data.ptrw(), comp_size) != comp_size) {
+		return;
+	}
+	ras.task_id = WorkerThreadPool::get_singleton()->add_native_task(&FileAccessCompressed::_decompress_span, &ras, false, String("FileAccessCompressedReadAhead"));
+}
+
+void FileAccessCompressed::_clear_read_ahead() {
+	for (ReadAheadSpan &ras : read_ahead) {
+		if (ras.task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(ras.task_id);
+		}
+	}
+	read_ahead.clear();
+}
+
+bool FileAccessCompressed::_read_block(uint32_t p_block) const {
+	if (!read_ahead.is_empty()) {
+		const uint32_t span = p_block / read_ahead_span_blocks;
+		const uint32_t span_count = (read_block_count + read_ahead_span_blocks - 1) / read_ahead_span_blocks;
+		for (uint32_t i = span; i < MIN(span + read_ahead.size(), span_count); i++) {
+			_queue_read_ahead(i);
+		}
+
+		ReadAheadSpan &ras = read_ahead[span % read_ahead.size()];
+		if (ras.task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(ras.task_id);
+			ras.task_id = WorkerThreadPool::INVALID_TASK_ID;
+		}
+		if (ras.failed) {
+			ras.first_block = UINT32_MAX; // Retry if read again.
+			ERR_FAIL_V_MSG(false, "Compressed file is corrupt.");
+		}
+		read_ptr = ras.data.ptr() + (p_block - ras.first_block) * block_size;
+	} else {
+		f->seek(read_blocks[p_block].offset);
+		f->get_buffer(comp_buffer.ptrw(), read_blocks[p_block].csize);
+		int ret = Compression::decompress(buffer.ptrw(), block_size, comp_buffer.ptr(), read_blocks[p_block].csize, cmode);
+		ERR_FAIL_COND_V_MSG(ret == -1, false, "Compressed file is corrupt.");
+		read_ptr = buffer.ptr();
+	}
+
+	read_block = p_block;
+	read_block_size = p_block == read_block_count - 1 ? read_total % block_size : block_size;
+	return true;
+}
+
+void FileAccessCompressed::_compress_block(void *p_blocks, uint32_t p_index) {
+	WriteBlocks *wb = (WriteBlocks *)p_blocks;
+	WriteBlock &block = wb->blocks[p_index];
+	block.comp_data.resize(Compression::get_max_compressed_buffer_size(block.size, wb->mode));
+	int s = Compression::compress(block.comp_data.ptrw(), block.src, block.size, wb->mode);
+	block.comp_data.resize(MAX(s, 0));
 }
 
 Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags) {
@@ -145,17 +252,29 @@ void FileAccessCompressed::_close() {
 			f->store_32(0); //compressed sizes, will update later
 		}
 
-		Vector<int> block_sizes;
+		// Blocks are compressed independently, in parallel when there are several.
+		WriteBlocks write_blocks;
+		write_blocks.mode = cmode;
+		write_blocks.blocks.resize(bc);
 		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
+			write_blocks.blocks[i].src = &write_ptr[i * block_size];
+			write_blocks.blocks[i].size = i == (bc - 1) ? write_max % block_size : block_size;
+		}
 
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+		if (bc > 1 && WorkerThreadPool::get_singleton()) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&FileAccessCompressed::_compress_block, &write_blocks, bc, -1, true, String("FileAccessCompressedCompress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < bc; i++) {
+				_compress_block(&write_blocks, i);
+			}
+		}
 
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
+		Vector<int> block_sizes;
+		for (uint32_t i = 0; i < bc; i++) {
+			const Vector<uint8_t> &cblock = write_blocks.blocks[i].comp_data;
+			f->store_buffer(cblock.ptr(), cblock.size());
+			block_sizes.push_back(cblock.size());
 		}
 
 		f->seek(16); //ok write block sizes
@@ -168,6 +287,8 @@ void FileAccessCompressed::_close() {
 		buffer.clear();
 
 	} else {
+		_clear_read_ahead();
+		read_ptr = nullptr;
 		comp_buffer.clear();
 		buffer.clear();
 		read_blocks.clear();
@@ -211,13 +332,8 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 			at_end = false;
 			read_eof = false;
 			uint32_t block_idx = p_position / block_size;
-			if (block_idx != read_block) {
-				read_block = block_idx;
-				f->seek(read_blocks[read_block].offset);
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+			if (block_idx != read_block && !_read_block(block_idx)) {
+				return;
 			}
 
 			read_pos = p_position % block_size;
@@ -274,18 +390,12 @@ uint8_t FileAccessCompressed::get_8() const {
 
 	read_pos++;
 	if (read_pos >= read_block_size) {
-		read_block++;
-
-		if (read_block < read_block_count) {
+		if (read_block + 1 < read_block_count) {
 			//read another block of compressed data
-			f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-			int total = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-			ERR_FAIL_COND_V_MSG(total == -1, 0, "Compressed file is corrupt.");
-			read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+			ERR_FAIL_COND_V(!_read_block(read_block + 1), 0);
 			read_pos = 0;
 
 		} else {
-			read_block--;
 			at_end = true;
 		}
 	}
@@ -303,27 +413,25 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 		return 0;
 	}
 
-	for (uint64_t i = 0; i < p_length; i++) {
-		p_dst[i] = read_ptr[read_pos];
-		read_pos++;
-		if (read_pos >= read_block_size) {
-			read_block++;
+	uint64_t done = 0;
+	while (done < p_length) {
+		uint64_t amount = MIN(p_length - done, (uint64_t)(read_block_size - read_pos));
+		memcpy(p_dst + done, read_ptr + read_pos, amount);
+		done += amount;
+		read_pos += amount;
 
-			if (read_block < read_block_count) {
+		if (read_pos >= read_block_size) {
+			if (read_block + 1 < read_block_count) {
 				//read another block of compressed data
-				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				int ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
-				ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
-				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
+				ERR_FAIL_COND_V(!_read_block(read_block + 1), -1);
 				read_pos = 0;
 
 			} else {
-				read_block--;
 				at_end = true;
-				if (i + 1 < p_length) {
+				if (done < p_length) {
 					read_eof = true;
 				}
-				return i + 1;
+				return done;
 			}
 		}
 	}
@@ -34,6 +34,8 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
 
 class FileAccessCompressed : public FileAccess {
 	Compression::Mode cmode = Compression::MODE_ZSTD;
@@ -51,8 +53,44 @@ class FileAccessCompressed : public FileAccess {
 		uint64_t offset;
 	};
 
+	// Blocks decompressed ahead of the reading position on the WorkerThreadPool. Consecutive
+	// blocks are grouped in spans, each read at once and decompressed by a single task, and
+	// kept in a ring indexed by span number.
+	struct ReadAheadSpan {
+		uint32_t first_block = UINT32_MAX;
+		uint32_t block_size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		LocalVector<uint32_t> comp_sizes;
+		Vector<uint8_t> comp_data;
+		Vector<uint8_t> data;
+		bool failed = true;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	static const uint32_t READ_AHEAD_SPAN_SIZE = 65536;
+
+	mutable LocalVector<ReadAheadSpan> read_ahead;
+	uint32_t read_ahead_span_blocks = 1;
+
+	static void _decompress_span(void *p_span);
+	void _queue_read_ahead(uint32_t p_span) const;
+	void _clear_read_ahead();
+
+	struct WriteBlock {
+		const uint8_t *src = nullptr;
+		uint32_t size = 0;
+		Vector<uint8_t> comp_data;
+	};
+
+	struct WriteBlocks {
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		LocalVector<WriteBlock> blocks;
+	};
+
+	static void _compress_block(void *p_blocks, uint32_t p_index);
+
 	mutable Vector<uint8_t> comp_buffer;
-	uint8_t *read_ptr = nullptr;
+	mutable const uint8_t *read_ptr = nullptr;
 	mutable uint32_t read_block = 0;
 	uint32_t read_block_count = 0;
 	mutable uint32_t read_block_size = 0;
@@ -64,6 +102,7 @@ class FileAccessCompressed : public FileAccess {
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	bool _read_block(uint32_t p_block) const;
 	void _close();
 
 public:
@@ -71,6 +110,10 @@ public:
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
+	// Decompresses up to p_blocks blocks ahead of the reading position in parallel, 0 to disable.
+	// Blocks are handed to tasks in spans of up to 64 KiB, so small blocks don't each cost a task.
+	void set_read_ahead(uint32_t p_blocks);
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
@@ -76,9 +76,26 @@ Error FileAccessMemory::open_custom(const uint8_t *p_data, uint64_t p_len) {
 	data = (uint8_t *)p_data;
 	length = p_len;
 	pos = 0;
+	buffer = nullptr;
 	return OK;
 }
 
+Error FileAccessMemory::open_buffer(Vector<uint8_t> *p_buffer) {
+	ERR_FAIL_NULL_V(p_buffer, ERR_INVALID_PARAMETER);
+	buffer = p_buffer;
+	data = buffer->ptrw();
+	length = buffer->size();
+	pos = 0;
+	return OK;
+}
+
+void FileAccessMemory::_grow(uint64_t p_length) {
+	// Vector already rounds allocations up to a power of 2, so growing a byte at a time is fine.
+	buffer->resize(p_length);
+	data = buffer->ptrw();
+	length = p_length;
+}
+
 Error FileAccessMemory::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_NULL_V(files, ERR_FILE_NOT_FOUND);
 
@@ -91,31 +108,32 @@ Error FileAccessMemory::open_internal(const String &p_path, int p_mode_flags) {
 	data = E->value.ptrw();
 	length = E->value.size();
 	pos = 0;
+	buffer = nullptr;
 
 	return OK;
 }
 
 bool FileAccessMemory::is_open() const {
-	return data != nullptr;
+	return data != nullptr || buffer != nullptr;
 }
 
 void FileAccessMemory::seek(uint64_t p_position) {
-	ERR_FAIL_NULL(data);
+	ERR_FAIL_COND(!is_open());
 	pos = p_position;
 }
 
 void FileAccessMemory::seek_end(int64_t p_position) {
-	ERR_FAIL_NULL(data);
+	ERR_FAIL_COND(!is_open());
 	pos = length + p_position;
 }
 
 uint64_t FileAccessMemory::get_position() const {
-	ERR_FAIL_NULL_V(data, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
 	return pos;
 }
 
 uint64_t FileAccessMemory::get_length() const {
-	ERR_FAIL_NULL_V(data, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
 	return length;
 }
 
@@ -155,10 +173,13 @@ Error FileAccessMemory::get_error() const {
 }
 
 void FileAccessMemory::flush() {
-	ERR_FAIL_NULL(data);
+	ERR_FAIL_COND(!is_open());
 }
 
 void FileAccessMemory::store_8(uint8_t p_byte) {
+	if (buffer && pos >= length) {
+		_grow(pos + 1);
+	}
 	ERR_FAIL_NULL(data);
 	ERR_FAIL_COND(pos >= length);
 	data[pos++] = p_byte;
@@ -166,6 +187,9 @@ void FileAccessMemory::store_8(uint8_t p_byte) {
 
 void FileAccessMemory::store_buffer(const uint8_t *p_src, uint64_t p_length) {
 	ERR_FAIL_COND(!p_src && p_length > 0);
+	if (buffer && pos + p_length > length) {
+		_grow(pos + p_length);
+	}
 	uint64_t left = length - pos;
 	uint64_t write = MIN(p_length, left);
 	if (write < p_length) {
@@ -38,14 +38,17 @@ class FileAccessMemory : public FileAccess {
 	uint8_t *data = nullptr;
 	uint64_t length = 0;
 	mutable uint64_t pos = 0;
+	Vector<uint8_t> *buffer = nullptr; // Grown when writing past its end, if opened with open_buffer().
 
 	static Ref<FileAccess> create();
+	void _grow(uint64_t p_length);
 
 public:
 	static void register_file(String p_name, Vector<uint8_t> p_data);
 	static void cleanup();
 
 	virtual Error open_custom(const uint8_t *p_data, uint64_t p_len); ///< open a file
+	Error open_buffer(Vector<uint8_t> *p_buffer); ///< open a buffer that grows as data is stored
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
@@ -31,6 +31,7 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/compression.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
@@ -48,7 +49,47 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::remove_pack(const String &p_path) {
+	// Files the pack replaced are not restored, as they were overwritten.
+	LocalVector<PathMD5> removed;
+	for (const KeyValue<PathMD5, PackedFile> &E : files) {
+		if (E.value.pack == p_path) {
+			removed.push_back(E.key);
+		}
+	}
+	for (const PathMD5 &E : removed) {
+		files.erase(E);
+	}
+
+	_remove_missing_paths(root, "res://");
+}
+
+bool PackedData::_remove_missing_paths(PackedDir *p_dir, const String &p_path) {
+	LocalVector<String> missing_files;
+	for (const String &E : p_dir->files) {
+		if (!files.has(PathMD5(p_path.path_join(E).md5_buffer()))) {
+			missing_files.push_back(E);
+		}
+	}
+	for (const String &E : missing_files) {
+		p_dir->files.erase(E);
+	}
+
+	LocalVector<String> empty_dirs;
+	for (const KeyValue<String, PackedDir *> &E : p_dir->subdirs) {
+		if (_remove_missing_paths(E.value, p_path.path_join(E.key))) {
+			empty_dirs.push_back(E.key);
+		}
+	}
+	for (const String &E : empty_dirs) {
+		_free_packed_dirs(p_dir->subdirs[E]);
+		p_dir->subdirs.erase(E);
+	}
+
+	return p_dir->files.is_empty() && p_dir->subdirs.is_empty();
+}
+
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -56,6 +97,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -202,7 +244,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	uint32_t ver_minor = f->get_32();
 	f->get_32(); // patch number, not used for validation.
 
-	ERR_FAIL_COND_V_MSG(version != PACK_FORMAT_VERSION, false, "Pack version unsupported: " + itos(version) + ".");
+	ERR_FAIL_COND_V_MSG(version < PACK_FORMAT_VERSION_MIN || version > PACK_FORMAT_VERSION, false, "Pack version unsupported: " + itos(version) + ".");
 	ERR_FAIL_COND_V_MSG(ver_major > VERSION_MAJOR || (ver_major == VERSION_MAJOR && ver_minor > VERSION_MINOR), false, "Pack created with a newer version of the engine: " + itos(ver_major) + "." + itos(ver_minor) + ".");
 
 	uint32_t pack_flags = f->get_32();
@@ -249,7 +291,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 	}
 
 	return true;
@@ -274,6 +316,50 @@ bool FileAccessPack::is_open() const {
 	}
 }
 
+bool FileAccessPack::_load_block(int64_t p_block) const {
+	if (p_block == current_block) {
+		return true;
+	}
+
+	ERR_FAIL_INDEX_V(p_block, block_offsets.size() - 1, false);
+
+	// Both sizes fit in an int, as the seek table was checked when opening.
+	const uint64_t block_start = p_block * block_size;
+	const int uncompressed_size = MIN((uint64_t)block_size, pf.size - block_start);
+	const int compressed_size = block_offsets[p_block + 1] - block_offsets[p_block];
+
+	f->seek(off + block_offsets[p_block]);
+	if (compressed_size == uncompressed_size) {
+		// Stored without compression.
+		ERR_FAIL_COND_V(f->get_buffer(block_data.ptrw(), compressed_size) != (uint64_t)compressed_size, false);
+	} else {
+		if (block_read_buffer.size() < compressed_size) {
+			block_read_buffer.resize(compressed_size);
+		}
+		ERR_FAIL_COND_V(f->get_buffer(block_read_buffer.ptrw(), compressed_size) != (uint64_t)compressed_size, false);
+		const int ret = Compression::decompress(block_data.ptrw(), uncompressed_size, block_read_buffer.ptr(), compressed_size, Compression::MODE_ZSTD);
+		ERR_FAIL_COND_V_MSG(ret != uncompressed_size, false, "Corrupted compressed pack-referenced file '" + String(pf.pack) + "'.");
+	}
+
+	current_block = p_block;
+	return true;
+}
+
+uint64_t FileAccessPack::_get_compressed_buffer(uint8_t *p_dst, uint64_t p_length) const {
+	uint64_t done = 0;
+	while (done < p_length) {
+		const uint64_t read_pos = pos + done;
+		if (!_load_block(read_pos / block_size)) {
+			break;
+		}
+		const uint64_t block_ofs = read_pos % block_size;
+		const uint64_t amount = MIN(p_length - done, MIN((uint64_t)block_size, pf.size - (read_pos - block_ofs)) - block_ofs);
+		memcpy(p_dst + done, block_data.ptr() + block_ofs, amount);
+		done += amount;
+	}
+	return done;
+}
+
 void FileAccessPack::seek(uint64_t p_position) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -283,7 +369,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!pf.compressed) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -310,6 +398,13 @@ uint8_t FileAccessPack::get_8() const {
 		return 0;
 	}
 
+	if (pf.compressed) {
+		uint8_t b = 0;
+		_get_compressed_buffer(&b, 1);
+		pos++;
+		return b;
+	}
+
 	pos++;
 	return f->get_8();
 }
@@ -328,11 +423,18 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
+		pos += to_read;
 		return 0;
 	}
+
+	if (pf.compressed) {
+		to_read = _get_compressed_buffer(p_dst, to_read);
+		pos += to_read;
+		return to_read;
+	}
+
+	pos += to_read;
 	f->get_buffer(p_dst, to_read);
 
 	return to_read;
@@ -396,6 +498,40 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		// The seek table is checked before anything is allocated from it, so that a corrupted
+		// table can't make reads go past the pack or allocate arbitrary amounts of memory.
+		block_size = f->get_32();
+		const uint64_t block_count = f->get_32();
+		const uint64_t table_size = 8 + block_count * 4;
+		const uint64_t available = f->get_length() > off ? f->get_length() - off : 0;
+		bool valid = block_size >= PACK_COMPRESSED_BLOCK_SIZE_MIN && block_size <= PACK_COMPRESSED_BLOCK_SIZE_MAX &&
+				block_count == (pf.size + block_size - 1) / block_size && table_size <= available;
+
+		if (valid) {
+			// Block offsets are relative to the start of the file data.
+			const uint64_t max_compressed_size = Compression::get_max_compressed_buffer_size(block_size, Compression::MODE_ZSTD);
+			block_offsets.resize(block_count + 1);
+			uint64_t *offsets = block_offsets.ptrw();
+			offsets[0] = table_size;
+			for (uint64_t i = 0; i < block_count && valid; i++) {
+				const uint64_t compressed_size = f->get_32();
+				offsets[i + 1] = offsets[i] + compressed_size;
+				valid = compressed_size > 0 && compressed_size <= max_compressed_size && offsets[i + 1] <= available;
+			}
+		}
+
+		if (!valid) {
+			// Without a seek table nothing can be read, so the file is reported as not open.
+			block_offsets.clear();
+			f = Ref<FileAccess>();
+			ERR_FAIL_MSG("Invalid compressed pack-referenced file '" + String(pf.pack) + "'.");
+		}
+
+		block_data.resize(block_size);
+	}
+
 	pos = 0;
 	eof = false;
 }
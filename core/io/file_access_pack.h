@@ -42,14 +42,27 @@
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
-#define PACK_FORMAT_VERSION 2
+#define PACK_FORMAT_VERSION 3
+// The oldest packed file format version that can still be read.
+// Version 3 adds compressed files, and is otherwise the same as version 2.
+#define PACK_FORMAT_VERSION_MIN 2
+// Compressed files are split in blocks of this size, compressed with Zstandard
+// independently of each other so any part of the file can be read on its own.
+// The file data starts with the block size, the block count and the compressed
+// size of each block, followed by the blocks. Blocks that don't shrink are
+// stored as is, with a compressed size equal to their uncompressed size.
+#define PACK_COMPRESSED_BLOCK_SIZE 65536
+// Range of block sizes accepted when reading.
+#define PACK_COMPRESSED_BLOCK_SIZE_MIN 4096
+#define PACK_COMPRESSED_BLOCK_SIZE_MAX (16 * 1024 * 1024)
 
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1,
 };
 
 class PackSource;
@@ -67,6 +80,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false;
 	};
 
 private:
@@ -107,16 +121,18 @@ private:
 	bool disabled = false;
 
 	void _free_packed_dirs(PackedDir *p_dir);
+	bool _remove_missing_paths(PackedDir *p_dir, const String &p_path);
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
 
 	static PackedData *get_singleton() { return singleton; }
 	Error add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset);
+	void remove_pack(const String &p_path);
 
 	_FORCE_INLINE_ Ref<FileAccess> try_open_path(const String &p_path);
 	_FORCE_INLINE_ bool has_path(const String &p_path);
@@ -149,6 +165,17 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// Seek table and current block of compressed files.
+	uint32_t block_size = 0;
+	Vector<uint64_t> block_offsets;
+	mutable Vector<uint8_t> block_data;
+	mutable Vector<uint8_t> block_read_buffer;
+	mutable int64_t current_block = -1;
+
+	bool _load_block(int64_t p_block) const;
+	uint64_t _get_compressed_buffer(uint8_t *p_dst, uint64_t p_length) const;
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
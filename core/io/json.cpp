@@ -47,38 +47,58 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-String JSON::_make_indent(const String &p_indent, int p_size) {
-	return p_indent.repeat(p_size);
+void JSON::_write(LocalVector<uint8_t> &r_buffer, const char *p_str) {
+	uint32_t len = strlen(p_str);
+	uint32_t ofs = r_buffer.size();
+	r_buffer.resize(ofs + len);
+	memcpy(r_buffer.ptr() + ofs, p_str, len);
 }
 
-String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
-	ERR_FAIL_COND_V_MSG(p_cur_indent > Variant::MAX_RECURSION_DEPTH, "...", "JSON structure is too deep. Bailing.");
+void JSON::_write(LocalVector<uint8_t> &r_buffer, const String &p_str) {
+	CharString cs = p_str.utf8();
+	uint32_t ofs = r_buffer.size();
+	r_buffer.resize(ofs + cs.length());
+	memcpy(r_buffer.ptr() + ofs, cs.get_data(), cs.length());
+}
 
-	String colon = ":";
-	String end_statement = "";
+void JSON::_write_indent(LocalVector<uint8_t> &r_buffer, const CharString &p_indent, int p_size) {
+	for (int i = 0; i < p_size; i++) {
+		uint32_t ofs = r_buffer.size();
+		r_buffer.resize(ofs + p_indent.length());
+		memcpy(r_buffer.ptr() + ofs, p_indent.get_data(), p_indent.length());
+	}
+}
 
-	if (!p_indent.is_empty()) {
-		colon += " ";
-		end_statement += "\n";
+void JSON::_stringify(LocalVector<uint8_t> &r_buffer, const Variant &p_var, const CharString &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
+		_write(r_buffer, "...");
+		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
 	}
 
+	const char *colon = p_indent.length() ? ": " : ":";
+	const char *end_statement = p_indent.length() ? "\n" : "";
+
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			return "null";
+			_write(r_buffer, "null");
+			return;
 		case Variant::BOOL:
-			return p_var.operator bool() ? "true" : "false";
+			_write(r_buffer, p_var.operator bool() ? "true" : "false");
+			return;
 		case Variant::INT:
-			return itos(p_var);
+			_write(r_buffer, itos(p_var));
+			return;
 		case Variant::FLOAT: {
 			double num = p_var;
 			if (p_full_precision) {
 				// Store unreliable digits (17) instead of just reliable
 				// digits (14) so that the value can be decoded exactly.
-				return String::num(num, 17 - (int)floor(log10(num)));
+				_write(r_buffer, String::num(num, 17 - (int)floor(log10(num))));
 			} else {
 				// Store only reliable digits (14) by default.
-				return String::num(num, 14 - (int)floor(log10(num)));
+				_write(r_buffer, String::num(num, 14 - (int)floor(log10(num))));
 			}
+			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
 		case Variant::PACKED_INT64_ARRAY:
@@ -88,31 +108,39 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (a.size() == 0) {
-				return "[]";
+				_write(r_buffer, "[]");
+				return;
 			}
-			String s = "[";
-			s += end_statement;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), "\"[...]\"", "Converting circular structure to JSON.");
+			if (p_markers.has(a.id())) {
+				_write(r_buffer, "\"[...]\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(a.id());
 
+			_write(r_buffer, "[");
+			_write(r_buffer, end_statement);
 			for (int i = 0; i < a.size(); i++) {
 				if (i > 0) {
-					s += ",";
-					s += end_statement;
+					_write(r_buffer, ",");
+					_write(r_buffer, end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_write_indent(r_buffer, p_indent, p_cur_indent + 1);
+				_stringify(r_buffer, a[i], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "]";
+			_write(r_buffer, end_statement);
+			_write_indent(r_buffer, p_indent, p_cur_indent);
+			_write(r_buffer, "]");
 			p_markers.erase(a.id());
-			return s;
+			return;
 		}
 		case Variant::DICTIONARY: {
-			String s = "{";
-			s += end_statement;
 			Dictionary d = p_var;
 
-			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), "\"{...}\"", "Converting circular structure to JSON.");
+			if (p_markers.has(d.id())) {
+				_write(r_buffer, "\"{...}\"");
+				ERR_FAIL_MSG("Converting circular structure to JSON.");
+			}
 			p_markers.insert(d.id());
 
 			List<Variant> keys;
@@ -122,29 +150,94 @@ String JSON::_stringify(const Variant &p_var, const String &p_indent, int p_cur_
 				keys.sort();
 			}
 
+			_write(r_buffer, "{");
+			_write(r_buffer, end_statement);
 			bool first_key = true;
 			for (const Variant &E : keys) {
 				if (first_key) {
 					first_key = false;
 				} else {
-					s += ",";
-					s += end_statement;
+					_write(r_buffer, ",");
+					_write(r_buffer, end_statement);
 				}
-				s += _make_indent(p_indent, p_cur_indent + 1) + _stringify(String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
-				s += colon;
-				s += _stringify(d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_write_indent(r_buffer, p_indent, p_cur_indent + 1);
+				_stringify(r_buffer, String(E), p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
+				_write(r_buffer, colon);
+				_stringify(r_buffer, d[E], p_indent, p_cur_indent + 1, p_sort_keys, p_markers);
 			}
 
-			s += end_statement + _make_indent(p_indent, p_cur_indent) + "}";
+			_write(r_buffer, end_statement);
+			_write_indent(r_buffer, p_indent, p_cur_indent);
+			_write(r_buffer, "}");
 			p_markers.erase(d.id());
-			return s;
+			return;
 		}
 		default:
-			return "\"" + String(p_var).json_escape() + "\"";
+			_write(r_buffer, "\"");
+			_write(r_buffer, String(p_var).json_escape());
+			_write(r_buffer, "\"");
+			return;
 	}
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+void JSON::_append_run(String &r_str, const UTF32Source &p_str, int p_from, int p_to) {
+	if (p_to > p_from) {
+		r_str += String(p_str.ptr + p_from, p_to - p_from);
+	}
+}
+
+void JSON::_append_run(String &r_str, const UTF8Source &p_str, int p_from, int p_to) {
+	if (p_to > p_from) {
+		r_str += String::utf8((const char *)p_str.ptr + p_from, p_to - p_from);
+	}
+}
+
+double JSON::_parse_number(const UTF32Source &p_str, int &index) {
+	const char32_t *rptr;
+	double number = String::to_float(&p_str.ptr[index], &rptr);
+	index += (rptr - &p_str.ptr[index]);
+	return number;
+}
+
+double JSON::_parse_number(const UTF8Source &p_str, int &index) {
+	// Widen the characters a number can be made of, and let the UTF-32 parser find where it ends.
+	const int max_len = 128;
+	char32_t buf[max_len + 1];
+	int len = 0;
+	while (len < max_len) {
+		char32_t c = p_str[index + len];
+		if (!is_digit(c) && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') {
+			break;
+		}
+		buf[len++] = c;
+	}
+
+	if (len == max_len) {
+		// Unusually long number.
+		String number_str;
+		while (true) {
+			char32_t c = p_str[index + len];
+			if (!is_digit(c) && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') {
+				break;
+			}
+			len++;
+		}
+		_append_run(number_str, p_str, index, index + len);
+		const char32_t *rptr;
+		double number = String::to_float(number_str.ptr(), &rptr);
+		index += (rptr - number_str.ptr());
+		return number;
+	}
+
+	buf[len] = 0;
+	const char32_t *rptr;
+	double number = String::to_float(buf, &rptr);
+	index += (rptr - buf);
+	return number;
+}
+
+template <typename S>
+Error JSON::_get_token(const S &p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
 		switch (p_str[index]) {
 			case '\n': {
@@ -189,14 +282,17 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			case '"': {
 				index++;
 				String str;
+				int run_start = index; // Characters are appended in runs, up to the next escape sequence.
 				while (true) {
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated String";
 						return ERR_PARSE_ERROR;
 					} else if (p_str[index] == '"') {
+						_append_run(str, p_str, run_start, index);
 						index++;
 						break;
 					} else if (p_str[index] == '\\') {
+						_append_run(str, p_str, run_start, index);
 						//escaped characters...
 						index++;
 						char32_t next = p_str[index];
@@ -312,12 +408,10 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						}
 
 						str += res;
+						run_start = index + 1;
 
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+					} else if (p_str[index] == '\n') {
+						line++;
 					}
 					index++;
 				}
@@ -335,11 +429,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 				if (p_str[index] == '-' || is_digit(p_str[index])) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
 					r_token.type = TK_NUMBER;
-					r_token.value = number;
+					r_token.value = _parse_number(p_str, index);
 					return OK;
 
 				} else if (is_ascii_char(p_str[index])) {
@@ -364,7 +455,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename S>
+Error JSON::_parse_value(Variant &value, Token &token, const S &p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> *r_keys, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep. Bailing.";
 		return ERR_OUT_OF_MEMORY;
@@ -372,14 +464,14 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 
 	if (token.type == TK_CURLY_BRACKET_OPEN) {
 		Dictionary d;
-		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_keys, r_err_str);
 		if (err) {
 			return err;
 		}
 		value = d;
 	} else if (token.type == TK_BRACKET_OPEN) {
 		Array a;
-		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_keys, r_err_str);
 		if (err) {
 			return err;
 		}
@@ -408,7 +500,8 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename S>
+Error JSON::_parse_array(Array &array, const S &p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> *r_keys, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -433,7 +526,7 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 		}
 
 		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_keys, r_err_str);
 		if (err) {
 			return err;
 		}
@@ -446,7 +539,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename S>
+Error JSON::_parse_object(Dictionary &object, const S &p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> *r_keys, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -495,11 +589,16 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 			}
 
 			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_keys, r_err_str);
 			if (err) {
 				return err;
 			}
-			object[key] = v;
+			if (r_keys) {
+				// Repeated keys share the data of their first occurrence.
+				object[*r_keys->insert(key)] = v;
+			} else {
+				object[key] = v;
+			}
 			need_comma = true;
 			at_key = true;
 		}
@@ -514,25 +613,24 @@ void JSON::set_data(const Variant &p_data) {
 	text.clear();
 }
 
-Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
-	const char32_t *str = p_json.ptr();
+template <typename S>
+Error JSON::_parse_source(const S &p_str, int p_len, bool p_intern_keys, Variant &r_ret, String &r_err_str, int &r_err_line) {
 	int idx = 0;
-	int len = p_json.length();
 	Token token;
 	r_err_line = 0;
-	String aux_key;
 
-	Error err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	Error err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 	if (err) {
 		return err;
 	}
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, r_err_str);
+	HashSet<String> keys;
+	err = _parse_value(r_ret, token, p_str, idx, p_len, r_err_line, 0, p_intern_keys ? &keys : nullptr, r_err_str);
 
 	// Check if EOF is reached
 	// or it's a type of the next token.
-	if (err == OK && idx < len) {
-		err = _get_token(str, idx, len, token, r_err_line, r_err_str);
+	if (err == OK && idx < p_len) {
+		err = _get_token(p_str, idx, p_len, token, r_err_line, r_err_str);
 
 		if (err || token.type != TK_EOF) {
 			r_err_str = "Expected 'EOF'";
@@ -546,7 +644,9 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 }
 
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
-	Error err = _parse_string(p_json_string, data, err_str, err_line);
+	UTF32Source source;
+	source.ptr = p_json_string.ptr();
+	Error err = _parse_source(source, p_json_string.length(), false, data, err_str, err_line);
 	if (err == Error::OK) {
 		err_line = 0;
 	}
@@ -556,15 +656,52 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8(const uint8_t *p_json, int p_len, bool p_keep_text, bool p_intern_keys) {
+	if (p_len >= 3 && p_json[0] == 0xef && p_json[1] == 0xbb && p_json[2] == 0xbf) {
+		// Skip BOM.
+		p_json += 3;
+		p_len -= 3;
+	}
+
+	UTF8Source source;
+	source.ptr = p_json;
+	source.len = p_len;
+	Error err = _parse_source(source, p_len, p_intern_keys, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	if (p_keep_text) {
+		text.parse_utf8((const char *)p_json, p_len);
+	}
+	return err;
+}
+
+Error JSON::parse_utf8_buffer(const PackedByteArray &p_json_buffer, bool p_keep_text, bool p_intern_keys) {
+	return parse_utf8(p_json_buffer.ptr(), p_json_buffer.size(), p_keep_text, p_intern_keys);
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
 
 String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	Ref<JSON> jason;
-	jason.instantiate();
+	LocalVector<uint8_t> buffer;
+	HashSet<const void *> markers;
+	_stringify(buffer, p_var, p_indent.utf8(), 0, p_sort_keys, markers, p_full_precision);
+	return String::utf8((const char *)buffer.ptr(), buffer.size());
+}
+
+PackedByteArray JSON::stringify_utf8_buffer(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	LocalVector<uint8_t> buffer;
 	HashSet<const void *> markers;
-	return jason->_stringify(p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	_stringify(buffer, p_var, p_indent.utf8(), 0, p_sort_keys, markers, p_full_precision);
+
+	PackedByteArray ret;
+	ret.resize(buffer.size());
+	if (buffer.size()) {
+		memcpy(ret.ptrw(), buffer.ptr(), buffer.size());
+	}
+	return ret;
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -577,8 +714,10 @@ Variant JSON::parse_string(const String &p_json_string) {
 
 void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_static_method("JSON", D_METHOD("stringify_utf8_buffer", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify_utf8_buffer, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8_buffer", "json_buffer", "keep_text", "intern_keys"), &JSON::parse_utf8_buffer, DEFVAL(false), DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -606,7 +745,8 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Vector<uint8_t> buffer = FileAccess::get_file_as_bytes(p_path);
+	Error err = json->parse_utf8(buffer.ptr(), buffer.size(), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
@@ -649,14 +789,17 @@ Error ResourceFormatSaverJSON::save(const Ref<Resource> &p_resource, const Strin
 	Ref<JSON> json = p_resource;
 	ERR_FAIL_COND_V(json.is_null(), ERR_INVALID_PARAMETER);
 
-	String source = json->get_parsed_text().is_empty() ? JSON::stringify(json->get_data(), "\t", false, true) : json->get_parsed_text();
-
 	Error err;
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
 
 	ERR_FAIL_COND_V_MSG(err, err, "Cannot save json '" + p_path + "'.");
 
-	file->store_string(source);
+	if (json->get_parsed_text().is_empty()) {
+		PackedByteArray source = JSON::stringify_utf8_buffer(json->get_data(), "\t", false, true);
+		file->store_buffer(source.ptr(), source.size());
+	} else {
+		file->store_string(json->get_parsed_text());
+	}
 	if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF) {
 		return ERR_CANT_CREATE;
 	}
@@ -35,6 +35,8 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class JSON : public Resource {
@@ -66,6 +68,20 @@ class JSON : public Resource {
 		Variant value;
 	};
 
+	// Parser input, either a NUL terminated UTF-32 string or a UTF-8 buffer.
+	struct UTF32Source {
+		const char32_t *ptr = nullptr;
+
+		_FORCE_INLINE_ char32_t operator[](int p_index) const { return ptr[p_index]; }
+	};
+
+	struct UTF8Source {
+		const uint8_t *ptr = nullptr;
+		int len = 0;
+
+		_FORCE_INLINE_ char32_t operator[](int p_index) const { return p_index < len ? ptr[p_index] : 0; }
+	};
+
 	String text;
 	Variant data;
 	String err_str;
@@ -73,22 +89,38 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static String _make_indent(const String &p_indent, int p_size);
-	static String _stringify(const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static void _append_run(String &r_str, const UTF32Source &p_str, int p_from, int p_to);
+	static void _append_run(String &r_str, const UTF8Source &p_str, int p_from, int p_to);
+	static double _parse_number(const UTF32Source &p_str, int &index);
+	static double _parse_number(const UTF8Source &p_str, int &index);
+
+	static void _write(LocalVector<uint8_t> &r_buffer, const char *p_str);
+	static void _write(LocalVector<uint8_t> &r_buffer, const String &p_str);
+	static void _write_indent(LocalVector<uint8_t> &r_buffer, const CharString &p_indent, int p_size);
+	static void _stringify(LocalVector<uint8_t> &r_buffer, const Variant &p_var, const CharString &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision = false);
+
+	template <typename S>
+	static Error _get_token(const S &p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
+	template <typename S>
+	static Error _parse_value(Variant &value, Token &token, const S &p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> *r_keys, String &r_err_str);
+	template <typename S>
+	static Error _parse_array(Array &array, const S &p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> *r_keys, String &r_err_str);
+	template <typename S>
+	static Error _parse_object(Dictionary &object, const S &p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> *r_keys, String &r_err_str);
+	template <typename S>
+	static Error _parse_source(const S &p_str, int p_len, bool p_intern_keys, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 protected:
 	static void _bind_methods();
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8(const uint8_t *p_json, int p_len, bool p_keep_text = false, bool p_intern_keys = false);
+	Error parse_utf8_buffer(const PackedByteArray &p_json_buffer, bool p_keep_text = false, bool p_intern_keys = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	static PackedByteArray stringify_utf8_buffer(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
 	inline Variant get_data() const { return data; }
@@ -60,6 +60,25 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define ENCODE_FLAG_64 1 << 16
 #define ENCODE_FLAG_OBJECT_AS_ID 1 << 16
 
+// Decodes little-endian values of 4 or 8 bytes, with a single copy when the host is little-endian too.
+template <class T>
+static void _decode_values(const uint8_t *p_buf, T *p_dst, int64_t p_count) {
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+#ifdef BIG_ENDIAN_ENABLED
+	for (int64_t i = 0; i < p_count; i++) {
+		if constexpr (sizeof(T) == 4) {
+			const uint32_t v = decode_uint32(p_buf + i * 4);
+			memcpy(p_dst + i, &v, 4);
+		} else {
+			const uint64_t v = decode_uint64(p_buf + i * 8);
+			memcpy(p_dst + i, &v, 8);
+		}
+	}
+#else
+	memcpy(p_dst, p_buf, p_count * sizeof(T));
+#endif
+}
+
 static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r_string) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
@@ -763,10 +782,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -790,12 +806,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int32_t> data;
 
 			if (count) {
-				//const int*rbuf=(const int*)buf;
 				data.resize(count);
-				int32_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_uint32(&buf[i * 4]);
-				}
+				_decode_values(buf, data.ptrw(), count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -814,12 +826,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int64_t> data;
 
 			if (count) {
-				//const int*rbuf=(const int*)buf;
 				data.resize(count);
-				int64_t *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_uint64(&buf[i * 8]);
-				}
+				_decode_values(buf, data.ptrw(), count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -838,12 +846,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<float> data;
 
 			if (count) {
-				//const float*rbuf=(const float*)buf;
 				data.resize(count);
-				float *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_float(&buf[i * 4]);
-				}
+				_decode_values(buf, data.ptrw(), count);
 			}
 			r_variant = data;
 
@@ -864,10 +868,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				double *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_double(&buf[i * 8]);
-				}
+				_decode_values(buf, data.ptrw(), count);
 			}
 			r_variant = data;
 
@@ -921,10 +922,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
+					_decode_values(buf, reinterpret_cast<real_t *>(w), count * 2);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 1);
 					}
+#endif
 
 					int adv = sizeof(double) * 2 * count;
 
@@ -946,10 +951,14 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 1);
 					}
+#else
+					_decode_values(buf, reinterpret_cast<real_t *>(w), count * 2);
+#endif
 
 					int adv = sizeof(float) * 2 * count;
 
@@ -981,11 +990,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
+					_decode_values(buf, reinterpret_cast<real_t *>(w), count * 3);
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 2);
 					}
+#endif
 
 					int adv = sizeof(double) * 3 * count;
 
@@ -1007,11 +1020,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 2);
 					}
+#else
+					_decode_values(buf, reinterpret_cast<real_t *>(w), count * 3);
+#endif
 
 					int adv = sizeof(float) * 3 * count;
 
@@ -1044,13 +1061,9 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				carray.resize(count);
 				Color *w = carray.ptrw();
 
-				for (int32_t i = 0; i < count; i++) {
-					// Colors should always be in single-precision.
-					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
-					w[i].g = decode_float(buf + i * 4 * 4 + 4 * 1);
-					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
-					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
-				}
+				// Colors should always be in single-precision.
+				static_assert(sizeof(Color) == 4 * sizeof(float));
+				_decode_values(buf, reinterpret_cast<float *>(w), count * 4);
 
 				int adv = 4 * 4 * count;
 
@@ -32,9 +32,12 @@
 #include "pck_packer.h"
 
 #include "core/crypto/crypto_core.h"
+#include "core/io/compression.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -47,9 +50,58 @@ static int _get_pad(int p_alignment, int p_n) {
 	return pad;
 }
 
+static uint64_t _get_encrypted_size(uint64_t p_size) {
+	uint64_t size = p_size;
+	if (size % 16) { // Pad to encryption block size.
+		size += 16 - (size % 16);
+	}
+	size += 16; // hash
+	size += 8; // data size
+	size += 16; // iv
+	return size;
+}
+
+// Splits the data in blocks compressed independently, preceded by the seek table
+// described in file_access_pack.h.
+static Vector<uint8_t> _compress_blocks(const Vector<uint8_t> &p_data) {
+	const uint64_t data_size = p_data.size();
+	const uint64_t block_count = (data_size + PACK_COMPRESSED_BLOCK_SIZE - 1) / PACK_COMPRESSED_BLOCK_SIZE;
+	const uint64_t header_size = 8 + block_count * 4;
+
+	Vector<uint8_t> ret;
+	ret.resize(header_size);
+	encode_uint32(PACK_COMPRESSED_BLOCK_SIZE, ret.ptrw());
+	encode_uint32(block_count, ret.ptrw() + 4);
+
+	// Blocks are compressed one at a time and appended, so only their compressed size is kept.
+	Vector<uint8_t> block;
+	block.resize(Compression::get_max_compressed_buffer_size(PACK_COMPRESSED_BLOCK_SIZE, Compression::MODE_ZSTD));
+
+	for (uint64_t i = 0; i < block_count; i++) {
+		const uint64_t src_ofs = i * PACK_COMPRESSED_BLOCK_SIZE;
+		const uint8_t *src = p_data.ptr() + src_ofs;
+		const int src_size = MIN((uint64_t)PACK_COMPRESSED_BLOCK_SIZE, data_size - src_ofs);
+		const uint8_t *stored = block.ptr();
+		int size = Compression::compress(block.ptrw(), src, src_size, Compression::MODE_ZSTD);
+		if (size <= 0 || size >= src_size) {
+			// Not worth compressing, store as is.
+			stored = src;
+			size = src_size;
+		}
+
+		const uint64_t ofs = ret.size();
+		ret.resize(ofs + size);
+		uint8_t *w = ret.ptrw();
+		encode_uint32(size, w + 8 + i * 4);
+		memcpy(w + ofs, stored, size);
+	}
+
+	return ret;
+}
+
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_name", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
-	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_file", "pck_path", "source_path", "encrypt", "compress"), &PCKPacker::add_file, DEFVAL(false), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
@@ -102,12 +154,11 @@ Error PCKPacker::pck_start(const String &p_file, int p_alignment, const String &
 	file->store_32(pack_flags); // flags
 
 	files.clear();
-	ofs = 0;
 
 	return OK;
 }
 
-Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt) {
+Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encrypt, bool p_compress) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
 	Ref<FileAccess> f = FileAccess::open(p_src, FileAccess::READ);
@@ -120,7 +171,6 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 	// symbols in them still match to the MD5 hash for the saved path.
 	pf.path = p_file.simplify_path();
 	pf.src_path = p_src;
-	pf.ofs = ofs;
 	pf.size = f->get_length();
 
 	Vector<uint8_t> data = FileAccess::get_file_as_bytes(p_src);
@@ -133,25 +183,22 @@ Error PCKPacker::add_file(const String &p_file, const String &p_src, bool p_encr
 		}
 	}
 	pf.encrypted = p_encrypt;
-
-	uint64_t _size = pf.size;
-	if (p_encrypt) { // Add encryption overhead.
-		if (_size % 16) { // Pad to encryption block size.
-			_size += 16 - (_size % 16);
-		}
-		_size += 16; // hash
-		_size += 8; // data size
-		_size += 16; // iv
-	}
-
-	int pad = _get_pad(alignment, ofs + _size);
-	ofs = ofs + _size + pad;
+	pf.compressed = p_compress;
 
 	files.push_back(pf);
 
 	return OK;
 }
 
+void PCKPacker::_compress_file(uint32_t p_index, CompressedFiles *p_compressed) {
+	const File &pf = files[p_compressed->files[p_index]];
+	Vector<uint8_t> data = FileAccess::get_file_as_bytes(pf.src_path);
+	if ((uint64_t)data.size() != pf.size) {
+		return; // Changed since it was added, reported when writing.
+	}
+	p_compressed->data[p_index] = _compress_blocks(data);
+}
+
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
@@ -165,7 +212,110 @@ Error PCKPacker::flush(bool p_verbose) {
 	// write the index
 	file->store_32(files.size());
 
+	// The size of compressed files is only known once they are written, so the
+	// space for the directory is reserved here, and it is written at the end.
+	int64_t dir_ofs = file->get_position();
+	uint64_t dir_size = 0;
+	for (int i = 0; i < files.size(); i++) {
+		int string_len = files[i].path.utf8().length();
+		dir_size += 4 + string_len + _get_pad(4, string_len) + 8 + 8 + 16 + 4;
+	}
+	if (enc_dir) {
+		dir_size = _get_encrypted_size(dir_size);
+	}
+
+	int header_padding = _get_pad(alignment, dir_ofs + dir_size);
+	for (uint64_t i = 0; i < dir_size + header_padding; i++) {
+		file->store_8(0);
+	}
+
+	int64_t file_base = file->get_position();
+
+	const uint32_t buf_max = 65536;
+	uint8_t *buf = memnew_arr(uint8_t, buf_max);
+
+	// Compressed files are compressed in parallel in batches, which bounds the
+	// memory used to hold them until they are written.
+	const uint64_t batch_max = 256 * 1024 * 1024;
+
 	Ref<FileAccessEncrypted> fae;
+	int count = 0;
+	int i = 0;
+	while (i < files.size()) {
+		CompressedFiles compressed;
+		uint64_t batch_size = 0;
+		int batch_end = i;
+		while (batch_end < files.size() && (batch_end == i || batch_size < batch_max)) {
+			if (files[batch_end].compressed) {
+				compressed.files.push_back(batch_end);
+				batch_size += files[batch_end].size;
+			}
+			batch_end++;
+		}
+
+		if (!compressed.files.is_empty()) {
+			compressed.data.resize(compressed.files.size());
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &PCKPacker::_compress_file, &compressed, compressed.files.size(), -1, false, String("PCKPackerCompress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+
+		uint32_t compressed_index = 0;
+		for (; i < batch_end; i++) {
+			files.write[i].ofs = file->get_position() - file_base;
+
+			Ref<FileAccess> ftmp = file;
+			if (files[i].encrypted) {
+				fae.instantiate();
+				ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
+
+				Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+				ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
+				ftmp = fae;
+			}
+
+			if (files[i].compressed) {
+				const Vector<uint8_t> &data = compressed.data[compressed_index++];
+				if (data.is_empty()) {
+					memdelete_arr(buf);
+					ERR_FAIL_V_MSG(ERR_FILE_CANT_READ, "Can't compress file, it was changed or removed since it was added: " + files[i].src_path + ".");
+				}
+				ftmp->store_buffer(data.ptr(), data.size());
+			} else {
+				Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
+				uint64_t to_write = files[i].size;
+				while (to_write > 0) {
+					uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
+					ftmp->store_buffer(buf, read);
+					to_write -= read;
+				}
+			}
+
+			if (fae.is_valid()) {
+				ftmp.unref();
+				fae.unref();
+			}
+
+			int pad = _get_pad(alignment, file->get_position());
+			for (int j = 0; j < pad; j++) {
+				file->store_8(0);
+			}
+
+			count += 1;
+			const int file_num = files.size();
+			if (p_verbose && (file_num > 0)) {
+				print_line(vformat("[%d/%d - %d%%] PCKPacker flush: %s -> %s", count, file_num, float(count) / file_num * 100, files[i].src_path, files[i].path));
+			}
+		}
+	}
+
+	memdelete_arr(buf);
+
+	int64_t file_end = file->get_position();
+	file->seek(file_base_ofs);
+	file->store_64(file_base); // update files base
+
+	file->seek(dir_ofs);
+
 	Ref<FileAccess> fhead = file;
 
 	if (enc_dir) {
@@ -178,24 +328,27 @@ Error PCKPacker::flush(bool p_verbose) {
 		fhead = fae;
 	}
 
-	for (int i = 0; i < files.size(); i++) {
-		int string_len = files[i].path.utf8().length();
+	for (int j = 0; j < files.size(); j++) {
+		int string_len = files[j].path.utf8().length();
 		int pad = _get_pad(4, string_len);
 
 		fhead->store_32(string_len + pad);
-		fhead->store_buffer((const uint8_t *)files[i].path.utf8().get_data(), string_len);
-		for (int j = 0; j < pad; j++) {
+		fhead->store_buffer((const uint8_t *)files[j].path.utf8().get_data(), string_len);
+		for (int k = 0; k < pad; k++) {
 			fhead->store_8(0);
 		}
 
-		fhead->store_64(files[i].ofs);
-		fhead->store_64(files[i].size); // pay attention here, this is where file is
-		fhead->store_buffer(files[i].md5.ptr(), 16); //also save md5 for file
+		fhead->store_64(files[j].ofs);
+		fhead->store_64(files[j].size); // pay attention here, this is where file is
+		fhead->store_buffer(files[j].md5.ptr(), 16); //also save md5 for file
 
 		uint32_t flags = 0;
-		if (files[i].encrypted) {
+		if (files[j].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (files[j].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -204,59 +357,10 @@ Error PCKPacker::flush(bool p_verbose) {
 		fae.unref();
 	}
 
-	int header_padding = _get_pad(alignment, file->get_position());
-	for (int i = 0; i < header_padding; i++) {
-		file->store_8(0);
-	}
-
-	int64_t file_base = file->get_position();
-	file->seek(file_base_ofs);
-	file->store_64(file_base); // update files base
-	file->seek(file_base);
-
-	const uint32_t buf_max = 65536;
-	uint8_t *buf = memnew_arr(uint8_t, buf_max);
-
-	int count = 0;
-	for (int i = 0; i < files.size(); i++) {
-		Ref<FileAccess> src = FileAccess::open(files[i].src_path, FileAccess::READ);
-		uint64_t to_write = files[i].size;
-
-		Ref<FileAccess> ftmp = file;
-		if (files[i].encrypted) {
-			fae.instantiate();
-			ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
-
-			Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
-			ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
-			ftmp = fae;
-		}
-
-		while (to_write > 0) {
-			uint64_t read = src->get_buffer(buf, MIN(to_write, buf_max));
-			ftmp->store_buffer(buf, read);
-			to_write -= read;
-		}
-
-		if (fae.is_valid()) {
-			ftmp.unref();
-			fae.unref();
-		}
-
-		int pad = _get_pad(alignment, file->get_position());
-		for (int j = 0; j < pad; j++) {
-			file->store_8(0);
-		}
-
-		count += 1;
-		const int file_num = files.size();
-		if (p_verbose && (file_num > 0)) {
-			print_line(vformat("[%d/%d - %d%%] PCKPacker flush: %s -> %s", count, file_num, float(count) / file_num * 100, files[i].src_path, files[i].path));
-		}
-	}
+	ERR_FAIL_COND_V(file->get_position() != (uint64_t)dir_ofs + dir_size, ERR_BUG);
+	file->seek(file_end);
 
 	file.unref();
-	memdelete_arr(buf);
 
 	return OK;
 }
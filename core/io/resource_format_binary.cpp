@@ -34,10 +34,12 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -98,6 +100,13 @@ enum {
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
 };
 
+// Files up to this size are read in the background while their header is parsed.
+static const uint64_t READ_AHEAD_MAX_SIZE = 64 * 1024 * 1024;
+// Internal resources are decoded in parallel when there are at least this many.
+static const int THREADED_DECODE_MIN_RESOURCES = 64;
+
+SafeNumeric<uint32_t> ResourceLoaderBinary::threaded_decode_count;
+
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
@@ -107,43 +116,57 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
+// Reads little-endian values of 4 or 8 bytes with a single get_buffer.
+template <class T>
+static void read_values(T *dst, Ref<FileAccess> &f, size_t count) {
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+	f->get_buffer((uint8_t *)dst, count * sizeof(T));
+#ifdef BIG_ENDIAN_ENABLED
+	if constexpr (sizeof(T) == 4) {
+		uint32_t *ptr = (uint32_t *)dst;
+		for (size_t i = 0; i < count; i++) {
+			ptr[i] = BSWAP32(ptr[i]);
+		}
+	} else {
+		uint64_t *ptr = (uint64_t *)dst;
+		for (size_t i = 0; i < count; i++) {
+			ptr[i] = BSWAP64(ptr[i]);
+		}
+	}
+#endif
+}
+
+// Reads values stored as S into T, a chunk at a time, rather than calling get_float()/get_double() for each.
+template <class S, class T>
+static void read_converted_values(T *dst, Ref<FileAccess> &f, size_t count) {
+	const size_t chunk_size = 1024;
+	S chunk[chunk_size];
+	for (size_t i = 0; i < count; i += chunk_size) {
+		const size_t n = MIN(count - i, chunk_size);
+		read_values(chunk, f, n);
+		for (size_t j = 0; j < n; j++) {
+			dst[i + j] = chunk[j];
+		}
+	}
+}
+
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
 			// Ideal case with double-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *dst = (uint64_t *)dst;
-				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP64(dst[i]);
-				}
-			}
-#endif
+			read_values(dst, f, count);
 		} else if constexpr (sizeof(real_t) == 4) {
 			// May be slower, but this is for compatibility. Eventually the data should be converted.
-			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_double();
-			}
+			read_converted_values<double>(dst, f, count);
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
 		}
 	} else {
 		if constexpr (sizeof(real_t) == 4) {
 			// Ideal case with float-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *dst = (uint32_t *)dst;
-				for (size_t i = 0; i < count; i++) {
-					dst[i] = BSWAP32(dst[i]);
-				}
-			}
-#endif
+			read_values(dst, f, count);
 		} else if constexpr (sizeof(real_t) == 8) {
-			for (size_t i = 0; i < count; ++i) {
-				dst[i] = f->get_float();
-			}
+			read_converted_values<float>(dst, f, count);
 		} else {
 			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "real_t size is neither 4 nor 8!");
 		}
@@ -436,6 +459,9 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
+					} else if (external_resources_completed) {
+						// Already completed, missing dependencies were reported then.
+						r_v = external_resources[erindex].resource;
 					} else {
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
@@ -515,16 +541,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			read_values(w, f, len);
 
 			r_v = array;
 		} break;
@@ -534,16 +551,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			read_values(w, f, len);
 
 			r_v = array;
 		} break;
@@ -553,16 +561,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			read_values(w, f, len);
 
 			r_v = array;
 		} break;
@@ -572,16 +571,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			read_values(w, f, len);
 
 			r_v = array;
 		} break;
@@ -631,16 +621,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len * 4; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			read_values(reinterpret_cast<float *>(w), f, len * 4);
 
 			r_v = array;
 		} break;
@@ -685,170 +666,361 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	const bool decode_threaded = internal_resources.size() >= THREADED_DECODE_MIN_RESOURCES && using_named_scene_ids && f->get_length() <= READ_AHEAD_MAX_SIZE && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1;
+
+	if (read_ahead_id != FileAccess::INVALID_ASYNC_READ_ID || decode_threaded) {
+		error = _read_file_to_memory();
+		if (error != OK) {
+			return error;
+		}
+	}
+
+	if (decode_threaded) {
+		return _load_internal_resources_threaded();
+	}
+
 	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		error = _create_internal_resource(i, res, missing_resource);
+		if (error != OK) {
+			return error;
+		}
+		if (res.is_null()) {
+			continue; // Already loaded.
+		}
 
-		//maybe it is loaded already
-		String path;
-		String id;
+		int pc = f->get_32();
 
-		if (!main) {
-			path = internal_resources[i].path;
+		//set properties
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+		Dictionary missing_resource_properties;
 
-				internal_resources.write[i].path = path; // Update path.
-			}
+		for (int j = 0; j < pc; j++) {
+			StringName name = _get_string();
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
+			if (name == StringName()) {
+				error = ERR_FILE_CORRUPT;
+				ERR_FAIL_V(ERR_FILE_CORRUPT);
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			Variant value;
+
+			error = parse_variant(value);
+			if (error) {
+				return error;
 			}
+
+			_set_internal_resource_property(res, missing_resource, name, value, missing_resource_properties);
 		}
 
-		uint64_t offset = internal_resources[i].offset;
+		if (_finish_internal_resource(i, res, missing_resource, missing_resource_properties)) {
+			return OK;
+		}
+	}
 
-		f->seek(offset);
+	return ERR_FILE_EOF;
+}
 
-		String t = get_unicode_string();
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-		Ref<Resource> res;
+	//maybe it is loaded already
+	String path;
+	String id;
+
+	if (!main) {
+		path = internal_resources[p_index].path;
+
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
+		}
 
-		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-			//use the existing one
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
 			Ref<Resource> cached = ResourceCache::get_ref(path);
-			if (cached->get_class() == t) {
-				cached->reset_state();
-				res = cached;
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				internal_index_cache[path] = cached;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
+	}
 
-		MissingResource *missing_resource = nullptr;
+	uint64_t offset = internal_resources[p_index].offset;
 
-		if (res.is_null()) {
-			//did not replace
-
-			Object *obj = ClassDB::instantiate(t);
-			if (!obj) {
-				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-					//create a missing resource
-					missing_resource = memnew(MissingResource);
-					missing_resource->set_original_class(t);
-					missing_resource->set_recording_properties(true);
-					obj = missing_resource;
-				} else {
-					error = ERR_FILE_CORRUPT;
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
-				}
-			}
+	f->seek(offset);
 
-			Resource *r = Object::cast_to<Resource>(obj);
-			if (!r) {
-				String obj_class = obj->get_class();
-				error = ERR_FILE_CORRUPT;
-				memdelete(obj); //bye
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
-			}
+	String t = get_unicode_string();
+
+	Ref<Resource> res;
+
+	if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+		//use the existing one
+		Ref<Resource> cached = ResourceCache::get_ref(path);
+		if (cached->get_class() == t) {
+			cached->reset_state();
+			res = cached;
+		}
+	}
+
+	MissingResource *missing_resource = nullptr;
+
+	if (res.is_null()) {
+		//did not replace
 
-			res = Ref<Resource>(r);
-			if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
-			} else if (!path.is_resource_file()) {
-				r->set_path_cache(path);
+		Object *obj = ClassDB::instantiate(t);
+		if (!obj) {
+			if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+				//create a missing resource
+				missing_resource = memnew(MissingResource);
+				missing_resource->set_original_class(t);
+				missing_resource->set_recording_properties(true);
+				obj = missing_resource;
+			} else {
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		Resource *r = Object::cast_to<Resource>(obj);
+		if (!r) {
+			String obj_class = obj->get_class();
+			memdelete(obj); //bye
+			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
 		}
 
-		int pc = f->get_32();
+		res = Ref<Resource>(r);
+		if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+			r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
+		} else if (!path.is_resource_file()) {
+			r->set_path_cache(path);
+		}
+		r->set_scene_unique_id(id);
+	}
 
-		//set properties
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		Dictionary missing_resource_properties;
+	r_res = res;
+	r_missing_resource = missing_resource;
+	return OK;
+}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+void ResourceLoaderBinary::_set_internal_resource_property(const Ref<Resource> &p_res, MissingResource *p_missing_resource, const StringName &p_name, Variant &p_value, Dictionary &r_missing_resource_properties) {
+	bool set_valid = true;
+	if (p_value.get_type() == Variant::OBJECT && p_missing_resource != nullptr) {
+		// If the property being set is a missing resource (and the parent is not),
+		// then setting it will most likely not work.
+		// Instead, save it as metadata.
+
+		Ref<MissingResource> mr = p_value;
+		if (mr.is_valid()) {
+			r_missing_resource_properties[p_name] = mr;
+			set_valid = false;
+		}
+	}
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
+	if (p_value.get_type() == Variant::ARRAY) {
+		Array set_array = p_value;
+		bool is_get_valid = false;
+		Variant get_value = p_res->get(p_name, &is_get_valid);
+		if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+			Array get_array = get_value;
+			if (!set_array.is_same_typed(get_array)) {
+				p_value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 			}
+		}
+	}
 
-			Variant value;
+	if (set_valid) {
+		p_res->set(p_name, p_value);
+	}
+}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+bool ResourceLoaderBinary::_finish_internal_resource(int p_index, const Ref<Resource> &p_res, MissingResource *p_missing_resource, const Dictionary &p_missing_resource_properties) {
+	if (p_missing_resource) {
+		p_missing_resource->set_recording_properties(false);
+	}
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+	if (!p_missing_resource_properties.is_empty()) {
+		p_res->set_meta(META_MISSING_RESOURCES, p_missing_resource_properties);
+	}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
+#ifdef TOOLS_ENABLED
+	p_res->set_edited(false);
+#endif
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+
+	resource_cache.push_back(p_res);
+
+	if (p_index == internal_resources.size() - 1) {
+		f.unref();
+		resource = p_res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+		return true;
+	}
+	return false;
+}
+
+Error ResourceLoaderBinary::_read_file_to_memory() {
+	if (read_ahead_id != FileAccess::INVALID_ASYNC_READ_ID) {
+		Error err = f->wait_for_async_read(read_ahead_id, read_ahead_data);
+		read_ahead_id = FileAccess::INVALID_ASYNC_READ_ID;
+		if (err != OK) {
+			read_ahead_data.clear();
+		}
+	}
+
+	if (read_ahead_data.is_empty()) {
+		// Not read in the background, e.g. files in packs or compressed files.
+		read_ahead_data.resize(f->get_length());
+		f->seek(0);
+		if (f->get_buffer(read_ahead_data.ptrw(), read_ahead_data.size()) != (uint64_t)read_ahead_data.size()) {
+			read_ahead_data.clear();
+			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Can't read file '" + local_path + "'.");
+		}
+	}
+
+	Ref<FileAccessMemory> fam;
+	fam.instantiate();
+	fam->open_custom(read_ahead_data.ptr(), read_ahead_data.size());
+	fam->set_big_endian(f->big_endian);
+	fam->real_is_double = f->real_is_double;
+	f = fam;
+	return OK;
+}
+
+void ResourceLoaderBinary::_decode_internal_resources_threaded(void *p_userdata) {
+	ThreadedDecode *td = (ThreadedDecode *)p_userdata;
+	const ResourceLoaderBinary *loader = td->loader;
+
+	// Each thread decodes with its own loader, reading from the file in memory.
+	ResourceLoaderBinary decoder;
+	Ref<FileAccessMemory> fam;
+	fam.instantiate();
+	fam->open_custom(loader->read_ahead_data.ptr(), loader->read_ahead_data.size());
+	fam->set_big_endian(loader->f->big_endian);
+	fam->real_is_double = loader->f->real_is_double;
+	decoder.f = fam;
+	decoder.local_path = loader->local_path;
+	decoder.res_path = loader->res_path;
+	decoder.ver_format = loader->ver_format;
+	decoder.using_named_scene_ids = loader->using_named_scene_ids;
+	decoder.string_map = loader->string_map;
+	decoder.external_resources = loader->external_resources;
+	decoder.external_resources_completed = true;
+	decoder.internal_resources = loader->internal_resources;
+	decoder.internal_index_cache = loader->internal_index_cache;
+
+	while (true) {
+		uint32_t index = td->next_resource.postincrement();
+		if (index >= td->resources.size()) {
+			break;
+		}
+
+		DecodedResource &dr = td->resources[index];
+		if (dr.resource.is_null()) {
+			continue;
+		}
+
+		decoder.f->seek(dr.properties_offset);
+		int pc = decoder.f->get_32();
+		for (int j = 0; j < pc; j++) {
+			StringName name = decoder._get_string();
+			if (name == StringName()) {
+				ERR_PRINT(loader->local_path + ": Invalid property name in internal resource.");
+				dr.error = ERR_FILE_CORRUPT;
+				break;
 			}
 
-			if (set_valid) {
-				res->set(name, value);
+			Variant value;
+			dr.error = decoder.parse_variant(value);
+			if (dr.error != OK) {
+				break;
 			}
+			dr.properties.push_back(Pair<StringName, Variant>(name, value));
 		}
+	}
+}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+Error ResourceLoaderBinary::_load_internal_resources_threaded() {
+	ThreadedDecode td;
+	td.loader = this;
+	td.resources.resize(internal_resources.size());
+
+	// Objects are created first, in file order, so references between them can be
+	// resolved while properties are decoded in parallel.
+	for (int i = 0; i < internal_resources.size(); i++) {
+		DecodedResource &dr = td.resources[i];
+		error = _create_internal_resource(i, dr.resource, dr.missing_resource);
+		if (error != OK) {
+			return error;
 		}
+		dr.properties_offset = f->get_position();
+	}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	// External resources are completed here, as it can't be done from other threads.
+	for (int i = 0; i < external_resources.size(); i++) {
+		Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[i].load_token;
+		if (load_token.is_null()) {
+			continue;
 		}
+		Error err;
+		external_resources.write[i].resource = ResourceLoader::_load_complete(*load_token.ptr(), &err);
+		if (external_resources[i].resource.is_null() && !ResourceLoader::is_cleaning_tasks()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, external_resources[i].path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + external_resources[i].path + ".");
+			}
+		}
+	}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
+	// The loading thread decodes too. Tasks are waited for one by one, so that a loader running
+	// on a pool thread (e.g. from ResourceLoader::load_threaded_request) keeps processing tasks.
+	threaded_decode_count.increment();
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	tasks.resize(WorkerThreadPool::get_singleton()->get_thread_count() - 1);
+	for (WorkerThreadPool::TaskID &task : tasks) {
+		task = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoaderBinary::_decode_internal_resources_threaded, &td, true, String("ResourceLoaderBinaryDecode"));
+	}
+	_decode_internal_resources_threaded(&td);
+	for (const WorkerThreadPool::TaskID &task : tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+	// Properties are set in file order, on the loading thread.
+	for (int i = 0; i < internal_resources.size(); i++) {
+		DecodedResource &dr = td.resources[i];
+		if (dr.resource.is_null()) {
+			continue; // Already loaded.
 		}
 
-		resource_cache.push_back(res);
+		if (dr.error != OK) {
+			error = dr.error;
+			return error;
+		}
 
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
+		Dictionary missing_resource_properties;
+		for (Pair<StringName, Variant> &property : dr.properties) {
+			_set_internal_resource_property(dr.resource, dr.missing_resource, property.first, property.second, missing_resource_properties);
+		}
+		dr.properties.clear();
+
+		if (_finish_internal_resource(i, dr.resource, dr.missing_resource, missing_resource_properties)) {
 			return OK;
 		}
 	}
@@ -952,6 +1124,10 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 			f.unref();
 			ERR_FAIL_MSG("Failed to open binary resource file: " + local_path + ".");
 		}
+		if (!p_no_resources) {
+			// Resources are read sequentially, decompress the next blocks in parallel.
+			fac->set_read_ahead(64);
+		}
 		f = fac;
 
 	} else if (header[0] != 'R' || header[1] != 'S' || header[2] != 'R' || header[3] != 'C') {
@@ -1020,6 +1196,10 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 		return;
 	}
 
+	if (read_ahead_enabled && f->can_read_async() && f->get_length() <= READ_AHEAD_MAX_SIZE) {
+		read_ahead_id = f->read_async(0, f->get_length());
+	}
+
 	uint32_t string_table_size = f->get_32();
 	string_map.resize(string_table_size);
 	for (uint32_t i = 0; i < string_table_size; i++) {
@@ -1181,6 +1361,7 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	loader.cache_mode = p_cache_mode;
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.progress = r_progress;
+	loader.read_ahead_enabled = true;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
@@ -2045,7 +2226,7 @@ static String _resource_get_class(Ref<Resource> p_resource) {
 	}
 }
 
-Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
+Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags, IncrementalCache *r_incremental_cache) {
 	Error err;
 	Ref<FileAccess> f;
 	if (p_flags & ResourceSaver::FLAG_COMPRESS) {
@@ -2065,6 +2246,7 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	bundle_resources = p_flags & ResourceSaver::FLAG_BUNDLE_RESOURCES;
 	big_endian = p_flags & ResourceSaver::FLAG_SAVE_BIG_ENDIAN;
 	takeover_paths = p_flags & ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS;
+	incremental_cache = r_incremental_cache;
 
 	if (!p_path.begins_with("res://")) {
 		takeover_paths = false;
@@ -2135,6 +2317,7 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	{
 		for (const Ref<Resource> &E : saved_resources) {
 			ResourceData &rd = resources.push_back(ResourceData())->get();
+			rd.id = E->get_instance_id();
 			rd.type = _resource_get_class(E);
 
 			List<PropertyInfo> property_list;
@@ -2259,16 +2442,40 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 
 	Vector<uint64_t> ofs_table;
 
+	// When saving incrementally, each resource is encoded to a block kept for the next save.
+	// Blocks of resources that didn't change are copied instead of being encoded again.
+	HashMap<ObjectID, IncrementalCache::Block> blocks;
+	uint64_t blocks_size = 0;
+	uint32_t reused_blocks = 0;
+	const bool reuse_blocks = incremental_cache && _can_reuse_blocks(save_order);
+
 	//now actually save the resources
 	for (const ResourceData &rd : resources) {
 		ofs_table.push_back(f->get_position());
-		save_unicode_string(f, rd.type);
-		f->store_32(rd.properties.size());
 
-		for (const Property &p : rd.properties) {
-			f->store_32(p.name_idx);
-			write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+		if (!incremental_cache) {
+			_write_resource(f, rd, resource_map);
+			continue;
 		}
+
+		IncrementalCache::Block block;
+		_fingerprint_resource(rd, block);
+
+		const IncrementalCache::Block *cached = reuse_blocks ? incremental_cache->blocks.getptr(rd.id) : nullptr;
+		if (cached && _is_block_reusable(*cached, block)) {
+			block.data = cached->data;
+			reused_blocks++;
+		} else {
+			Ref<FileAccessMemory> fa;
+			fa.instantiate();
+			fa->open_buffer(&block.data);
+			fa->set_big_endian(big_endian);
+			_write_resource(fa, rd, resource_map);
+		}
+
+		f->store_buffer(block.data.ptr(), block.data.size());
+		blocks_size += block.data.size() + block.properties.size() * sizeof(Pair<int, uint64_t>);
+		blocks.insert(rd.id, block);
 	}
 
 	for (int i = 0; i < ofs_table.size(); i++) {
@@ -2284,9 +2491,249 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 		return ERR_CANT_CREATE;
 	}
 
+	if (incremental_cache) {
+		incremental_cache->resource = p_resource->get_instance_id();
+		incremental_cache->big_endian = big_endian;
+		incremental_cache->strings = strings;
+		incremental_cache->external_resources.resize(save_order.size());
+		for (int i = 0; i < save_order.size(); i++) {
+			incremental_cache->external_resources.write[i] = save_order[i]->get_instance_id();
+		}
+		incremental_cache->internal_resources.clear();
+		for (const Ref<Resource> &r : saved_resources) {
+			incremental_cache->internal_resources.push_back(r->get_instance_id());
+		}
+		incremental_cache->blocks = blocks;
+		incremental_cache->size = blocks_size;
+		incremental_cache->reused_blocks = reused_blocks;
+	}
+
 	return OK;
 }
 
+void ResourceFormatSaverBinaryInstance::_write_resource(Ref<FileAccess> f, const ResourceData &p_resource_data, HashMap<Ref<Resource>, int> &p_resource_map) {
+	save_unicode_string(f, p_resource_data.type);
+	f->store_32(p_resource_data.properties.size());
+
+	for (const Property &p : p_resource_data.properties) {
+		f->store_32(p.name_idx);
+		write_variant(f, p.value, p_resource_map, external_resources, string_map, p.pi);
+	}
+}
+
+bool ResourceFormatSaverBinaryInstance::_can_reuse_blocks(const Vector<Ref<Resource>> &p_external_resources) {
+	// Blocks store the indices of strings and resources, which must still point to the same ones.
+	// New strings and external resources are added at the end, so they don't change the existing indices.
+	if (incremental_cache->big_endian != big_endian || incremental_cache->strings.size() > strings.size() || incremental_cache->external_resources.size() > p_external_resources.size() || incremental_cache->internal_resources.size() != saved_resources.size()) {
+		return false;
+	}
+
+	for (int i = 0; i < incremental_cache->strings.size(); i++) {
+		if (incremental_cache->strings[i] != strings[i]) {
+			return false;
+		}
+	}
+
+	for (int i = 0; i < incremental_cache->external_resources.size(); i++) {
+		if (incremental_cache->external_resources[i] != p_external_resources[i]->get_instance_id()) {
+			return false;
+		}
+	}
+
+	int i = 0;
+	for (const Ref<Resource> &r : saved_resources) {
+		if (incremental_cache->internal_resources[i++] != r->get_instance_id()) {
+			return false;
+		}
+	}
+
+	strings_added = incremental_cache->strings.size() != strings.size();
+	return true;
+}
+
+// 64-bit fingerprint of a buffer, made of two 32-bit hashes with different seeds.
+static uint64_t _fingerprint_buffer(const void *p_data, uint64_t p_size, uint64_t p_prev) {
+	uint32_t lo = uint32_t(p_prev);
+	uint32_t hi = uint32_t(p_prev >> 32) ^ 0x9e3779b9;
+	const uint8_t *data = (const uint8_t *)p_data;
+	do {
+		const int chunk = (int)MIN(p_size, (uint64_t)INT32_MAX);
+		lo = hash_murmur3_buffer(data, chunk, lo);
+		hi = hash_murmur3_buffer(data, chunk, hi);
+		data += chunk;
+		p_size -= chunk;
+	} while (p_size > 0);
+	return (uint64_t(hi) << 32) | lo;
+}
+
+// Values are hashed from their memory, so floats are compared bitwise and -0.0 isn't taken for 0.0.
+template <class T>
+static uint64_t _fingerprint_pod(const T &p_value, uint64_t p_prev) {
+	return _fingerprint_buffer(&p_value, sizeof(T), p_prev);
+}
+
+template <class T>
+static uint64_t _fingerprint_packed_array(const Vector<T> &p_array, uint64_t p_prev) {
+	return _fingerprint_buffer(p_array.ptr(), p_array.size() * sizeof(T), hash_djb2_one_64(p_array.size(), p_prev));
+}
+
+static uint64_t _fingerprint_string(const String &p_string, uint64_t p_prev) {
+	return _fingerprint_buffer(p_string.ptr(), p_string.length() * sizeof(char32_t), hash_djb2_one_64(p_string.length(), p_prev));
+}
+
+// Fingerprint of how p_value is encoded. Resources are identified by their instance, as only their index is saved.
+static uint64_t _fingerprint_value(const Variant &p_value, uint64_t p_prev, bool &r_has_node_paths) {
+	const uint64_t h = hash_djb2_one_64(p_value.get_type(), p_prev);
+
+	switch (p_value.get_type()) {
+		case Variant::NIL: {
+			return h;
+		}
+		case Variant::BOOL:
+		case Variant::INT: {
+			return hash_djb2_one_64(uint64_t(int64_t(p_value)), h);
+		}
+		case Variant::FLOAT: {
+			return _fingerprint_pod<double>(p_value, h);
+		}
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			return _fingerprint_string(p_value, h);
+		}
+		case Variant::NODE_PATH: {
+			r_has_node_paths = true;
+			return _fingerprint_string(p_value, h);
+		}
+		case Variant::VECTOR2: {
+			return _fingerprint_pod<Vector2>(p_value, h);
+		}
+		case Variant::VECTOR2I: {
+			return _fingerprint_pod<Vector2i>(p_value, h);
+		}
+		case Variant::RECT2: {
+			return _fingerprint_pod<Rect2>(p_value, h);
+		}
+		case Variant::RECT2I: {
+			return _fingerprint_pod<Rect2i>(p_value, h);
+		}
+		case Variant::VECTOR3: {
+			return _fingerprint_pod<Vector3>(p_value, h);
+		}
+		case Variant::VECTOR3I: {
+			return _fingerprint_pod<Vector3i>(p_value, h);
+		}
+		case Variant::TRANSFORM2D: {
+			return _fingerprint_pod<Transform2D>(p_value, h);
+		}
+		case Variant::VECTOR4: {
+			return _fingerprint_pod<Vector4>(p_value, h);
+		}
+		case Variant::VECTOR4I: {
+			return _fingerprint_pod<Vector4i>(p_value, h);
+		}
+		case Variant::PLANE: {
+			return _fingerprint_pod<Plane>(p_value, h);
+		}
+		case Variant::AABB: {
+			return _fingerprint_pod<AABB>(p_value, h);
+		}
+		case Variant::BASIS: {
+			return _fingerprint_pod<Basis>(p_value, h);
+		}
+		case Variant::TRANSFORM3D: {
+			return _fingerprint_pod<Transform3D>(p_value, h);
+		}
+		case Variant::PROJECTION: {
+			return _fingerprint_pod<Projection>(p_value, h);
+		}
+		case Variant::COLOR: {
+			return _fingerprint_pod<Color>(p_value, h);
+		}
+		case Variant::OBJECT: {
+			const Object *obj = p_value.get_validated_object();
+			return hash_djb2_one_64(obj ? uint64_t(obj->get_instance_id()) : 0, h);
+		}
+		case Variant::ARRAY: {
+			const Array a = p_value;
+			uint64_t ah = hash_djb2_one_64(a.size(), h);
+			for (int i = 0; i < a.size(); i++) {
+				ah = _fingerprint_value(a[i], ah, r_has_node_paths);
+			}
+			return ah;
+		}
+		case Variant::DICTIONARY: {
+			// Keys are saved in order, so their order is part of the fingerprint.
+			const Dictionary d = p_value;
+			uint64_t dh = hash_djb2_one_64(d.size(), h);
+			List<Variant> keys;
+			d.get_key_list(&keys);
+			for (const Variant &E : keys) {
+				dh = _fingerprint_value(E, dh, r_has_node_paths);
+				dh = _fingerprint_value(d[E], dh, r_has_node_paths);
+			}
+			return dh;
+		}
+		case Variant::PACKED_BYTE_ARRAY: {
+			return _fingerprint_packed_array<uint8_t>(p_value, h);
+		}
+		case Variant::PACKED_INT32_ARRAY: {
+			return _fingerprint_packed_array<int32_t>(p_value, h);
+		}
+		case Variant::PACKED_INT64_ARRAY: {
+			return _fingerprint_packed_array<int64_t>(p_value, h);
+		}
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			return _fingerprint_packed_array<float>(p_value, h);
+		}
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			return _fingerprint_packed_array<double>(p_value, h);
+		}
+		case Variant::PACKED_STRING_ARRAY: {
+			const PackedStringArray a = p_value;
+			uint64_t ah = hash_djb2_one_64(a.size(), h);
+			for (const String &E : a) {
+				ah = _fingerprint_string(E, ah);
+			}
+			return ah;
+		}
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			return _fingerprint_packed_array<Vector2>(p_value, h);
+		}
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			return _fingerprint_packed_array<Vector3>(p_value, h);
+		}
+		case Variant::PACKED_COLOR_ARRAY: {
+			return _fingerprint_packed_array<Color>(p_value, h);
+		}
+		default: {
+			return hash_djb2_one_64(p_value.hash(), h);
+		}
+	}
+}
+
+void ResourceFormatSaverBinaryInstance::_fingerprint_resource(const ResourceData &p_resource_data, IncrementalCache::Block &r_block) const {
+	r_block.type = p_resource_data.type;
+	r_block.properties.resize(p_resource_data.properties.size());
+	uint32_t i = 0;
+	for (const Property &p : p_resource_data.properties) {
+		r_block.properties[i++] = Pair<int, uint64_t>(p.name_idx, _fingerprint_value(p.value, 5381, r_block.has_node_paths));
+	}
+}
+
+bool ResourceFormatSaverBinaryInstance::_is_block_reusable(const IncrementalCache::Block &p_cached, const IncrementalCache::Block &p_block) const {
+	if (p_cached.type != p_block.type || p_cached.properties.size() != p_block.properties.size() || (p_cached.has_node_paths && strings_added)) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < p_block.properties.size(); i++) {
+		if (p_cached.properties[i] != p_block.properties[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 Error ResourceFormatSaverBinaryInstance::set_uid(const String &p_path, ResourceUID::ID p_uid) {
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_OPEN, "Cannot open file '" + p_path + "'.");
@@ -2406,7 +2853,83 @@ Error ResourceFormatSaverBinaryInstance::set_uid(const String &p_path, ResourceU
 Error ResourceFormatSaverBinary::save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags) {
 	String local_path = ProjectSettings::get_singleton()->localize_path(p_path);
 	ResourceFormatSaverBinaryInstance saver;
-	return saver.save(local_path, p_resource, p_flags);
+
+	// The cache of the path is taken out while saving, so saves to other paths can run meanwhile.
+	// Concurrent saves to the same path find no cache and encode everything.
+	ResourceFormatSaverBinaryInstance::IncrementalCache *cache = nullptr;
+	{
+		MutexLock lock(incremental_caches_mutex);
+		HashMap<String, ResourceFormatSaverBinaryInstance::IncrementalCache *>::Iterator E = incremental_caches.find(local_path);
+		if (E) {
+			cache = E->value;
+			incremental_caches.remove(E);
+		}
+	}
+
+	if (!(p_flags & ResourceSaver::FLAG_INCREMENTAL)) {
+		if (cache) {
+			memdelete(cache);
+		}
+		return saver.save(local_path, p_resource, p_flags);
+	}
+
+	if (!cache) {
+		cache = memnew(ResourceFormatSaverBinaryInstance::IncrementalCache);
+	}
+	Error err = saver.save(local_path, p_resource, p_flags, cache);
+	if (err != OK) {
+		memdelete(cache);
+		return err;
+	}
+
+	MutexLock lock(incremental_caches_mutex);
+	cache->last_save = ++incremental_save_count;
+	HashMap<String, ResourceFormatSaverBinaryInstance::IncrementalCache *>::Iterator E = incremental_caches.find(local_path);
+	if (E) {
+		// Saved concurrently, keep the latest.
+		memdelete(E->value);
+		E->value = cache;
+	} else {
+		incremental_caches.insert(local_path, cache);
+	}
+	_trim_incremental_caches();
+	return OK;
+}
+
+void ResourceFormatSaverBinary::_trim_incremental_caches() {
+	// Resources that were freed won't be saved again.
+	LocalVector<String> freed;
+	uint64_t total_size = 0;
+	for (const KeyValue<String, ResourceFormatSaverBinaryInstance::IncrementalCache *> &E : incremental_caches) {
+		if (!ObjectDB::get_instance(E.value->resource)) {
+			freed.push_back(E.key);
+		} else {
+			total_size += E.value->size;
+		}
+	}
+	for (const String &E : freed) {
+		memdelete(incremental_caches[E]);
+		incremental_caches.erase(E);
+	}
+
+	// Past the size limit, drop what was saved the longest time ago.
+	while (total_size > INCREMENTAL_CACHES_MAX_SIZE) {
+		HashMap<String, ResourceFormatSaverBinaryInstance::IncrementalCache *>::Iterator oldest = incremental_caches.begin();
+		for (HashMap<String, ResourceFormatSaverBinaryInstance::IncrementalCache *>::Iterator E = incremental_caches.begin(); E; ++E) {
+			if (E->value->last_save < oldest->value->last_save) {
+				oldest = E;
+			}
+		}
+		total_size -= oldest->value->size;
+		memdelete(oldest->value);
+		incremental_caches.remove(oldest);
+	}
+}
+
+int ResourceFormatSaverBinary::get_incremental_reused_blocks(const String &p_path) {
+	MutexLock lock(incremental_caches_mutex);
+	ResourceFormatSaverBinaryInstance::IncrementalCache *const *cache = incremental_caches.getptr(ProjectSettings::get_singleton()->localize_path(p_path));
+	return cache ? (int)(*cache)->reused_blocks : -1;
 }
 
 Error ResourceFormatSaverBinary::set_uid(const String &p_path, ResourceUID::ID p_uid) {
@@ -2432,3 +2955,9 @@ ResourceFormatSaverBinary *ResourceFormatSaverBinary::singleton = nullptr;
 ResourceFormatSaverBinary::ResourceFormatSaverBinary() {
 	singleton = this;
 }
+
+ResourceFormatSaverBinary::~ResourceFormatSaverBinary() {
+	for (const KeyValue<String, ResourceFormatSaverBinaryInstance::IncrementalCache *> &E : incremental_caches) {
+		memdelete(E.value);
+	}
+}
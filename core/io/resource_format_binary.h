@@ -35,6 +35,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -46,6 +50,13 @@ class ResourceLoaderBinary {
 
 	Ref<FileAccess> f;
 
+	// The file is read in the background while its header is parsed and its
+	// external resources are loaded, then internal resources are parsed from memory.
+	// Only enabled when loading, other queries only read the header.
+	bool read_ahead_enabled = false;
+	FileAccess::AsyncReadID read_ahead_id = FileAccess::INVALID_ASYNC_READ_ID;
+	Vector<uint8_t> read_ahead_data;
+
 	uint64_t importmd_ofs = 0;
 
 	ResourceUID::ID uid = ResourceUID::INVALID_ID;
@@ -62,6 +73,7 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		Ref<Resource> resource;
 	};
 
 	bool using_named_scene_ids = false;
@@ -70,6 +82,7 @@ class ResourceLoaderBinary {
 	bool use_sub_threads = false;
 	float *progress = nullptr;
 	Vector<ExtResource> external_resources;
+	bool external_resources_completed = false;
 
 	struct IntResource {
 		String path;
@@ -91,6 +104,30 @@ class ResourceLoaderBinary {
 
 	Error parse_variant(Variant &r_v);
 
+	Error _create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource);
+	void _set_internal_resource_property(const Ref<Resource> &p_res, MissingResource *p_missing_resource, const StringName &p_name, Variant &p_value, Dictionary &r_missing_resource_properties);
+	bool _finish_internal_resource(int p_index, const Ref<Resource> &p_res, MissingResource *p_missing_resource, const Dictionary &p_missing_resource_properties);
+
+	struct DecodedResource {
+		Ref<Resource> resource;
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+	};
+
+	struct ThreadedDecode {
+		const ResourceLoaderBinary *loader = nullptr;
+		LocalVector<DecodedResource> resources;
+		SafeNumeric<uint32_t> next_resource;
+	};
+
+	static SafeNumeric<uint32_t> threaded_decode_count;
+
+	static void _decode_internal_resources_threaded(void *p_userdata);
+	Error _read_file_to_memory();
+	Error _load_internal_resources_threaded();
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
@@ -105,6 +142,9 @@ public:
 	void get_dependencies(Ref<FileAccess> p_f, List<String> *p_dependencies, bool p_add_types);
 	void get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes);
 
+	// For tests, how many loads decoded their internal resources in parallel.
+	static uint32_t get_threaded_decode_count() { return threaded_decode_count.get(); }
+
 	ResourceLoaderBinary() {}
 };
 
@@ -154,6 +194,7 @@ class ResourceFormatSaverBinaryInstance {
 	};
 
 	struct ResourceData {
+		ObjectID id;
 		String type;
 		List<Property> properties;
 	};
@@ -163,6 +204,39 @@ class ResourceFormatSaverBinaryInstance {
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
 	int get_string_index(const String &p_string);
 
+public:
+	// What a previous save to the same path wrote, kept for ResourceSaver::FLAG_INCREMENTAL.
+	// Property values aren't kept, only a fingerprint of each, so that the cache doesn't hold
+	// references to resources or old copies of their data.
+	struct IncrementalCache {
+		struct Block {
+			String type;
+			LocalVector<Pair<int, uint64_t>> properties; // Name index and fingerprint of the value.
+			bool has_node_paths = false; // NodePath names are encoded differently once they are in the string table.
+			Vector<uint8_t> data;
+		};
+
+		ObjectID resource;
+		bool big_endian = false;
+		Vector<StringName> strings;
+		Vector<ObjectID> external_resources;
+		Vector<ObjectID> internal_resources;
+		HashMap<ObjectID, Block> blocks;
+
+		uint64_t size = 0;
+		uint64_t last_save = 0;
+		uint32_t reused_blocks = 0;
+	};
+
+private:
+	IncrementalCache *incremental_cache = nullptr;
+	bool strings_added = false;
+
+	bool _can_reuse_blocks(const Vector<Ref<Resource>> &p_external_resources);
+	void _fingerprint_resource(const ResourceData &p_resource_data, IncrementalCache::Block &r_block) const;
+	bool _is_block_reusable(const IncrementalCache::Block &p_cached, const IncrementalCache::Block &p_block) const;
+	void _write_resource(Ref<FileAccess> f, const ResourceData &p_resource_data, HashMap<Ref<Resource>, int> &p_resource_map);
+
 public:
 	enum {
 		FORMAT_FLAG_NAMED_SCENE_IDS = 1,
@@ -173,20 +247,32 @@ public:
 		// Amount of reserved 32-bit fields in resource header
 		RESERVED_FIELDS = 11
 	};
-	Error save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags = 0);
+	Error save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags = 0, IncrementalCache *r_incremental_cache = nullptr);
 	Error set_uid(const String &p_path, ResourceUID::ID p_uid);
 	static void write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint = PropertyInfo());
 };
 
 class ResourceFormatSaverBinary : public ResourceFormatSaver {
+	static const uint64_t INCREMENTAL_CACHES_MAX_SIZE = 64 * 1024 * 1024;
+
+	// Only held to look up, take out and put back caches, not while saving.
+	Mutex incremental_caches_mutex;
+	HashMap<String, ResourceFormatSaverBinaryInstance::IncrementalCache *> incremental_caches;
+	uint64_t incremental_save_count = 0;
+
+	void _trim_incremental_caches();
+
 public:
 	static ResourceFormatSaverBinary *singleton;
 	virtual Error save(const Ref<Resource> &p_resource, const String &p_path, uint32_t p_flags = 0);
+	// For tests, how many sub-resources the last incremental save to p_path copied instead of encoding them, -1 if nothing is kept for it.
+	int get_incremental_reused_blocks(const String &p_path);
 	virtual Error set_uid(const String &p_path, ResourceUID::ID p_uid);
 	virtual bool recognize(const Ref<Resource> &p_resource) const;
 	virtual void get_recognized_extensions(const Ref<Resource> &p_resource, List<String> *p_extensions) const;
 
 	ResourceFormatSaverBinary();
+	~ResourceFormatSaverBinary();
 };
 
 #endif // RESOURCE_FORMAT_BINARY_H
@@ -60,6 +60,85 @@ static _FORCE_INLINE_ char32_t lower_case(char32_t c) {
 	return (is_ascii_upper_case(c) ? (c + ('a' - 'A')) : c);
 }
 
+// Word-at-a-time ASCII fast path for UTF-8 decoding. Returns true if the 8 bytes
+// at p_utf8 are ASCII, with no NUL, nor CR if it should be skipped.
+static _FORCE_INLINE_ bool _is_ascii_block(const char *p_utf8, bool p_skip_cr) {
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t high_bits = 0x8080808080808080ULL;
+
+	uint64_t word;
+	memcpy(&word, p_utf8, sizeof(word));
+	if (word & high_bits) {
+		return false;
+	}
+	if ((word - ones) & ~word & high_bits) {
+		return false; // Has a NUL byte.
+	}
+	if (p_skip_cr) {
+		uint64_t cr = word ^ (ones * '\r');
+		if ((cr - ones) & ~cr & high_bits) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Substring search used by find(), rfind(), count(), split() and replace().
+// Candidate positions are filtered on the key's first and last characters
+// before the remaining characters are compared, so most of the haystack is
+// rejected by a tight loop with no inner iteration.
+template <bool C, typename T>
+static _FORCE_INLINE_ char32_t _search_char(T p_char) {
+	if constexpr (C) {
+		return _find_lower((char32_t)p_char);
+	} else {
+		return (char32_t)p_char;
+	}
+}
+
+template <bool C, typename T>
+static int _find_substr(const char32_t *p_src, int p_len, int p_from, const T *p_key, int p_key_len) {
+	const int last = p_key_len - 1;
+	const char32_t first_char = _search_char<C>(p_key[0]);
+	const char32_t last_char = _search_char<C>(p_key[last]);
+
+	const char32_t *end = p_src + p_len - last;
+	for (const char32_t *c = p_src + p_from; c < end; c++) {
+		if (_search_char<C>(*c) != first_char || _search_char<C>(c[last]) != last_char) {
+			continue;
+		}
+		int j = 1;
+		while (j < last && _search_char<C>(c[j]) == _search_char<C>(p_key[j])) {
+			j++;
+		}
+		if (j >= last) {
+			return c - p_src;
+		}
+	}
+	return -1;
+}
+
+template <bool C, typename T>
+static int _rfind_substr(const char32_t *p_src, int p_from, const T *p_key, int p_key_len) {
+	const int last = p_key_len - 1;
+	const char32_t first_char = _search_char<C>(p_key[0]);
+	const char32_t last_char = _search_char<C>(p_key[last]);
+
+	for (const char32_t *c = p_src + p_from; c >= p_src; c--) {
+		if (_search_char<C>(*c) != first_char || _search_char<C>(c[last]) != last_char) {
+			continue;
+		}
+		int j = 1;
+		while (j < last && _search_char<C>(c[j]) == _search_char<C>(p_key[j])) {
+			j++;
+		}
+		if (j >= last) {
+			return c - p_src;
+		}
+	}
+	return -1;
+}
+
 const char CharString::_null = 0;
 const char16_t Char16String::_null = 0;
 const char32_t String::_null = 0;
@@ -1253,39 +1332,50 @@ Vector<String> String::split(const String &p_splitter, bool p_allow_empty, int p
 		return ret;
 	}
 
+	const char32_t *src = get_data();
+	const char32_t *splitter = p_splitter.get_data();
+	const int splitter_len = p_splitter.length();
+	const int len = length();
+
+	// Find all the slices first, so the result is allocated only once.
+	LocalVector<Pair<int, int>> slices;
 	int from = 0;
-	int len = length();
 
 	while (true) {
 		int end;
-		if (p_splitter.is_empty()) {
+		if (splitter_len == 0) {
 			end = from + 1;
 		} else {
-			end = find(p_splitter, from);
+			end = _find_substr<false>(src, len, from, splitter, splitter_len);
 			if (end < 0) {
 				end = len;
 			}
 		}
 		if (p_allow_empty || (end > from)) {
-			if (p_maxsplit <= 0) {
-				ret.push_back(substr(from, end - from));
-			} else {
+			if (p_maxsplit > 0 && p_maxsplit == (int)slices.size()) {
 				// Put rest of the string and leave cycle.
-				if (p_maxsplit == ret.size()) {
-					ret.push_back(substr(from, len));
-					break;
-				}
-
-				// Otherwise, push items until positive limit is reached.
-				ret.push_back(substr(from, end - from));
+				slices.push_back(Pair<int, int>(from, len - from));
+				break;
 			}
+
+			// Otherwise, push items until positive limit is reached.
+			slices.push_back(Pair<int, int>(from, end - from));
 		}
 
 		if (end == len) {
 			break;
 		}
 
-		from = end + p_splitter.length();
+		from = end + splitter_len;
+	}
+
+	ret.resize(slices.size());
+	String *ret_ptrw = ret.ptrw();
+	for (uint32_t i = 0; i < slices.size(); i++) {
+		// Empty slices are left as empty strings, copy_from_unchecked() expects at least one character.
+		if (slices[i].second > 0) {
+			ret_ptrw[i].copy_from_unchecked(src + slices[i].first, slices[i].second);
+		}
 	}
 
 	return ret;
@@ -1819,6 +1909,10 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		}
 	}
 
+	if (p_len < 0) {
+		p_len = strlen(p_utf8);
+	}
+
 	bool decode_error = false;
 	bool decode_failed = false;
 	{
@@ -1827,6 +1921,12 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 		int skip = 0;
 		uint8_t c_start = 0;
 		while (ptrtmp != ptrtmp_limit && *ptrtmp) {
+			if (skip == 0 && ptrtmp_limit - ptrtmp >= 8 && _is_ascii_block(ptrtmp, p_skip_cr)) {
+				str_size += 8;
+				cstr_size += 8;
+				ptrtmp += 8;
+				continue;
+			}
 #if CHAR_MIN == 0
 			uint8_t c = *ptrtmp;
 #else
@@ -1899,6 +1999,16 @@ Error String::parse_utf8(const char *p_utf8, int p_len, bool p_skip_cr) {
 	int skip = 0;
 	uint32_t unichar = 0;
 	while (cstr_size) {
+		if (skip == 0 && cstr_size >= 8 && _is_ascii_block(p_utf8, p_skip_cr)) {
+			for (int i = 0; i < 8; i++) {
+				dst[i] = (char32_t)p_utf8[i];
+			}
+			dst += 8;
+			cstr_size -= 8;
+			p_utf8 += 8;
+			continue;
+		}
+
 #if CHAR_MIN == 0
 		uint8_t c = *p_utf8;
 #else
@@ -1986,6 +2096,11 @@ CharString String::utf8() const {
 	const char32_t *d = &operator[](0);
 	int fl = 0;
 	for (int i = 0; i < l; i++) {
+		if (i + 4 <= l && (d[i] | d[i + 1] | d[i + 2] | d[i + 3]) <= 0x7f) { // ASCII fast path.
+			fl += 4;
+			i += 3;
+			continue;
+		}
 		uint32_t c = d[i];
 		if (c <= 0x7f) { // 7 bits.
 			fl += 1;
@@ -2018,6 +2133,14 @@ CharString String::utf8() const {
 #define APPEND_CHAR(m_c) *(cdst++) = m_c
 
 	for (int i = 0; i < l; i++) {
+		if (i + 4 <= l && (d[i] | d[i + 1] | d[i + 2] | d[i + 3]) <= 0x7f) { // ASCII fast path.
+			APPEND_CHAR(d[i]);
+			APPEND_CHAR(d[i + 1]);
+			APPEND_CHAR(d[i + 2]);
+			APPEND_CHAR(d[i + 3]);
+			i += 3;
+			continue;
+		}
 		uint32_t c = d[i];
 
 		if (c <= 0x7f) { // 7 bits.
@@ -3008,31 +3131,7 @@ int String::find(const String &p_str, int p_from) const {
 		return -1; // won't find anything!
 	}
 
-	const char32_t *src = get_data();
-	const char32_t *str = p_str.get_data();
-
-	for (int i = p_from; i <= (len - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			if (src[read_pos] != str[j]) {
-				found = false;
-				break;
-			}
-		}
-
-		if (found) {
-			return i;
-		}
-	}
-
-	return -1;
+	return _find_substr<false>(get_data(), len, p_from, p_str.get_data(), src_len);
 }
 
 int String::find(const char *p_str, int p_from) const {
@@ -3046,46 +3145,12 @@ int String::find(const char *p_str, int p_from) const {
 		return -1; // won't find anything!
 	}
 
-	const char32_t *src = get_data();
-
-	int src_len = 0;
-	while (p_str[src_len] != '\0') {
-		src_len++;
-	}
-
-	if (src_len == 1) {
-		const char32_t needle = p_str[0];
-
-		for (int i = p_from; i < len; i++) {
-			if (src[i] == needle) {
-				return i;
-			}
-		}
-
-	} else {
-		for (int i = p_from; i <= (len - src_len); i++) {
-			bool found = true;
-			for (int j = 0; j < src_len; j++) {
-				int read_pos = i + j;
-
-				if (read_pos >= len) {
-					ERR_PRINT("read_pos>=len");
-					return -1;
-				}
-
-				if (src[read_pos] != (char32_t)p_str[j]) {
-					found = false;
-					break;
-				}
-			}
-
-			if (found) {
-				return i;
-			}
-		}
+	const int src_len = strlen(p_str);
+	if (src_len == 0) {
+		return p_from <= len ? p_from : -1;
 	}
 
-	return -1;
+	return _find_substr<false>(get_data(), len, p_from, p_str, src_len);
 }
 
 int String::find_char(const char32_t &p_char, int p_from) const {
@@ -3158,33 +3223,7 @@ int String::findn(const String &p_str, int p_from) const {
 		return -1; // won't find anything!
 	}
 
-	const char32_t *srcd = get_data();
-
-	for (int i = p_from; i <= (length() - src_len); i++) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= length()) {
-				ERR_PRINT("read_pos>=length()");
-				return -1;
-			}
-
-			char32_t src = _find_lower(srcd[read_pos]);
-			char32_t dst = _find_lower(p_str[j]);
-
-			if (src != dst) {
-				found = false;
-				break;
-			}
-		}
-
-		if (found) {
-			return i;
-		}
-	}
-
-	return -1;
+	return _find_substr<true>(get_data(), length(), p_from, p_str.get_data(), src_len);
 }
 
 int String::rfind(const String &p_str, int p_from) const {
@@ -3208,30 +3247,7 @@ int String::rfind(const String &p_str, int p_from) const {
 		return -1; // won't find anything!
 	}
 
-	const char32_t *src = get_data();
-
-	for (int i = p_from; i >= 0; i--) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			if (src[read_pos] != p_str[j]) {
-				found = false;
-				break;
-			}
-		}
-
-		if (found) {
-			return i;
-		}
-	}
-
-	return -1;
+	return _rfind_substr<false>(get_data(), p_from, p_str.get_data(), src_len);
 }
 
 int String::rfindn(const String &p_str, int p_from) const {
@@ -3255,33 +3271,7 @@ int String::rfindn(const String &p_str, int p_from) const {
 		return -1; // won't find anything!
 	}
 
-	const char32_t *src = get_data();
-
-	for (int i = p_from; i >= 0; i--) {
-		bool found = true;
-		for (int j = 0; j < src_len; j++) {
-			int read_pos = i + j;
-
-			if (read_pos >= len) {
-				ERR_PRINT("read_pos>=len");
-				return -1;
-			}
-
-			char32_t srcc = _find_lower(src[read_pos]);
-			char32_t dstc = _find_lower(p_str[j]);
-
-			if (srcc != dstc) {
-				found = false;
-				break;
-			}
-		}
-
-		if (found) {
-			return i;
-		}
-	}
-
-	return -1;
+	return _rfind_substr<true>(get_data(), p_from, p_str.get_data(), src_len);
 }
 
 bool String::ends_with(const String &p_string) const {
@@ -3377,31 +3367,29 @@ int String::_count(const String &p_string, int p_from, int p_to, bool p_case_ins
 	if (len < slen) {
 		return 0;
 	}
-	String str;
-	if (p_from >= 0 && p_to >= 0) {
-		if (p_to == 0) {
-			p_to = len;
-		} else if (p_from >= p_to) {
-			return 0;
-		}
-		if (p_from == 0 && p_to == len) {
-			str = String();
-			str.copy_from_unchecked(&get_data()[0], len);
-		} else {
-			str = substr(p_from, p_to - p_from);
-		}
-	} else {
+	if (p_from < 0 || p_to < 0) {
+		return 0;
+	}
+	if (p_to == 0 || p_to > len) {
+		p_to = len;
+	}
+	if (p_from >= p_to) {
 		return 0;
 	}
+
+	// Search in place within [p_from, p_to), without copying the range.
+	const char32_t *src = get_data();
+	const char32_t *key = p_string.get_data();
 	int c = 0;
-	int idx = -1;
-	do {
-		idx = p_case_insensitive ? str.findn(p_string) : str.find(p_string);
-		if (idx != -1) {
-			str = str.substr(idx + slen, str.length() - slen);
-			++c;
+	int idx = p_from;
+	while (true) {
+		idx = p_case_insensitive ? _find_substr<true>(src, p_to, idx, key, slen) : _find_substr<false>(src, p_to, idx, key, slen);
+		if (idx == -1) {
+			break;
 		}
-	} while (idx != -1);
+		idx += slen;
+		++c;
+	}
 	return c;
 }
 
@@ -3569,48 +3557,56 @@ String String::format(const Variant &values, String placeholder) const {
 	return new_string;
 }
 
-String String::replace(const String &p_key, const String &p_with) const {
-	String new_string;
-	int search_from = 0;
-	int result = 0;
-
-	while ((result = find(p_key, search_from)) >= 0) {
-		new_string += substr(search_from, result - search_from);
-		new_string += p_with;
-		search_from = result + p_key.length();
+// Replaces all the occurrences of p_key in p_string. The matches are found first,
+// so the result is sized and written in a single allocation.
+template <bool C, typename K, typename W>
+static String _replace_all(const String &p_string, const K *p_key, int p_key_len, const W *p_with, int p_with_len) {
+	const char32_t *src = p_string.get_data();
+	const int len = p_string.length();
+	if (p_key_len == 0 || len == 0) {
+		return p_string;
 	}
 
-	if (search_from == 0) {
-		return *this;
+	LocalVector<int> matches;
+	int result = _find_substr<C>(src, len, 0, p_key, p_key_len);
+	while (result >= 0) {
+		matches.push_back(result);
+		result = _find_substr<C>(src, len, result + p_key_len, p_key, p_key_len);
 	}
 
-	new_string += substr(search_from, length() - search_from);
-
-	return new_string;
-}
+	if (matches.is_empty()) {
+		return p_string;
+	}
 
-String String::replace(const char *p_key, const char *p_with) const {
 	String new_string;
+	new_string.resize(len + (int)matches.size() * (p_with_len - p_key_len) + 1);
+	char32_t *dst = new_string.ptrw();
 	int search_from = 0;
-	int result = 0;
-
-	while ((result = find(p_key, search_from)) >= 0) {
-		new_string += substr(search_from, result - search_from);
-		new_string += p_with;
-		int k = 0;
-		while (p_key[k] != '\0') {
-			k++;
+	for (const int &match : matches) {
+		memcpy(dst, src + search_from, (match - search_from) * sizeof(char32_t));
+		dst += match - search_from;
+		for (int i = 0; i < p_with_len; i++) {
+			if constexpr (sizeof(W) == 1) {
+				*dst++ = (uint8_t)p_with[i];
+			} else {
+				*dst++ = p_with[i];
+			}
 		}
-		search_from = result + k;
+		search_from = match + p_key_len;
 	}
+	memcpy(dst, src + search_from, (len - search_from) * sizeof(char32_t));
+	dst += len - search_from;
+	*dst = 0;
 
-	if (search_from == 0) {
-		return *this;
-	}
+	return new_string;
+}
 
-	new_string += substr(search_from, length() - search_from);
+String String::replace(const String &p_key, const String &p_with) const {
+	return _replace_all<false>(*this, p_key.get_data(), p_key.length(), p_with.get_data(), p_with.length());
+}
 
-	return new_string;
+String String::replace(const char *p_key, const char *p_with) const {
+	return _replace_all<false>(*this, p_key, strlen(p_key), p_with, strlen(p_with));
 }
 
 String String::replace_first(const String &p_key, const String &p_with) const {
@@ -3623,22 +3619,7 @@ String String::replace_first(const String &p_key, const String &p_with) const {
 }
 
 String String::replacen(const String &p_key, const String &p_with) const {
-	String new_string;
-	int search_from = 0;
-	int result = 0;
-
-	while ((result = findn(p_key, search_from)) >= 0) {
-		new_string += substr(search_from, result - search_from);
-		new_string += p_with;
-		search_from = result + p_key.length();
-	}
-
-	if (search_from == 0) {
-		return *this;
-	}
-
-	new_string += substr(search_from, length() - search_from);
-	return new_string;
+	return _replace_all<true>(*this, p_key.get_data(), p_key.length(), p_with.get_data(), p_with.length());
 }
 
 String String::repeat(int p_count) const {
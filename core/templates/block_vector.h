@@ -0,0 +1,354 @@
+/**************************************************************************/
+/*  block_vector.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BLOCK_VECTOR_H
+#define BLOCK_VECTOR_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+/**
+ * An indexed sequence stored as a list of blocks, for very long sequences edited in the middle.
+ *
+ * Inserting or removing an element only shifts the elements of its own block. Block sizes are
+ * kept in a Fenwick tree, so finding the block of an index and updating the offsets of the
+ * following blocks are logarithmic in the amount of blocks. Indexing is constant time when
+ * accessing elements close to the previous access, as sequential loops do. Blocks are split
+ * once they grow past twice BLOCK_SIZE, and merged with a neighbour once they shrink below a
+ * quarter of BLOCK_SIZE.
+ *
+ * Unlike Vector, this is not copy-on-write, and copying it copies every element.
+ */
+
+template <class T, uint32_t BLOCK_SIZE = 256>
+class BlockVector {
+	LocalVector<LocalVector<T> *> blocks;
+	// Fenwick tree of the block sizes (1-based), so that block offsets are prefix sums.
+	LocalVector<uint32_t> size_tree;
+	uint32_t size_tree_step = 0; // Highest power of two not above the amount of blocks.
+	uint32_t count = 0;
+	mutable uint32_t last_block = 0;
+	mutable uint32_t last_offset = 0;
+
+	_FORCE_INLINE_ static uint32_t _lowest_bit(uint32_t p_value) {
+		return p_value & (~p_value + 1);
+	}
+
+	void _rebuild_size_tree() {
+		const uint32_t block_count = blocks.size();
+		size_tree.resize(block_count + 1);
+		size_tree[0] = 0;
+		for (uint32_t i = 1; i <= block_count; i++) {
+			size_tree[i] = blocks[i - 1]->size();
+		}
+		for (uint32_t i = 1; i <= block_count; i++) {
+			const uint32_t parent = i + _lowest_bit(i);
+			if (parent <= block_count) {
+				size_tree[parent] += size_tree[i];
+			}
+		}
+		size_tree_step = next_power_of_2(block_count + 1) / 2;
+
+		last_block = 0;
+		last_offset = 0;
+	}
+
+	void _add_block_size(uint32_t p_block, int32_t p_amount) {
+		for (uint32_t i = p_block + 1; i < size_tree.size(); i += _lowest_bit(i)) {
+			size_tree[i] += p_amount;
+		}
+	}
+
+	// Returns the block holding the element at p_index, and the index of its first element in r_offset.
+	_FORCE_INLINE_ uint32_t _find_block(uint32_t p_index, uint32_t &r_offset) const {
+		if (likely(last_block < blocks.size())) {
+			const uint32_t last_end = last_offset + blocks[last_block]->size();
+			if (p_index >= last_offset && p_index < last_end) {
+				r_offset = last_offset;
+				return last_block;
+			}
+			// Next block, for sequential access.
+			const uint32_t next = last_block + 1;
+			if (next < blocks.size() && p_index >= last_end && p_index < last_end + blocks[next]->size()) {
+				last_block = next;
+				last_offset = last_end;
+				r_offset = last_end;
+				return next;
+			}
+		}
+
+		// Finds the amount of blocks that end at or before the index, i.e. the index of its block.
+		uint32_t block = 0;
+		uint32_t offset = 0;
+		for (uint32_t step = size_tree_step; step > 0; step >>= 1) {
+			if (block + step < size_tree.size() && offset + size_tree[block + step] <= p_index) {
+				block += step;
+				offset += size_tree[block];
+			}
+		}
+		last_block = block;
+		last_offset = offset;
+		r_offset = offset;
+		return block;
+	}
+
+	void _split_block(uint32_t p_block) {
+		LocalVector<T> *block = blocks[p_block];
+		const uint32_t half = block->size() / 2;
+
+		LocalVector<T> *new_block = memnew(LocalVector<T>);
+		new_block->reserve(BLOCK_SIZE * 2);
+		for (uint32_t i = half; i < block->size(); i++) {
+			new_block->push_back((*block)[i]);
+		}
+		block->resize(half);
+
+		blocks.insert(p_block + 1, new_block);
+	}
+
+	void _remove_block(uint32_t p_block) {
+		memdelete(blocks[p_block]);
+		blocks.remove_at(p_block);
+	}
+
+	_FORCE_INLINE_ bool _is_block_too_small(uint32_t p_block) const {
+		return blocks[p_block]->is_empty() || (blocks[p_block]->size() < BLOCK_SIZE / 4 && blocks.size() > 1);
+	}
+
+	// Removes an empty block, or merges a small one with its smaller neighbour. Rebuilds the size tree.
+	void _merge_block(uint32_t p_block) {
+		if (blocks[p_block]->is_empty()) {
+			_remove_block(p_block);
+		} else if (blocks.size() > 1) {
+			uint32_t first = p_block;
+			if (p_block + 1 == blocks.size() || (p_block > 0 && blocks[p_block - 1]->size() <= blocks[p_block + 1]->size())) {
+				first = p_block - 1;
+			}
+
+			LocalVector<T> *into = blocks[first];
+			const LocalVector<T> *from = blocks[first + 1];
+			into->reserve(into->size() + from->size());
+			for (uint32_t i = 0; i < from->size(); i++) {
+				into->push_back((*from)[i]);
+			}
+			_remove_block(first + 1);
+
+			if (into->size() > BLOCK_SIZE * 2) {
+				_split_block(first);
+			}
+		}
+		_rebuild_size_tree();
+	}
+
+public:
+	_FORCE_INLINE_ int64_t size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+
+	_FORCE_INLINE_ const T &operator[](int64_t p_index) const {
+		CRASH_BAD_INDEX(p_index, count);
+		uint32_t offset;
+		const uint32_t block = _find_block(p_index, offset);
+		return (*blocks[block])[p_index - offset];
+	}
+
+	_FORCE_INLINE_ T &operator[](int64_t p_index) {
+		CRASH_BAD_INDEX(p_index, count);
+		uint32_t offset;
+		const uint32_t block = _find_block(p_index, offset);
+		return (*blocks[block])[p_index - offset];
+	}
+
+	void insert(int64_t p_index, const T &p_value) {
+		ERR_FAIL_INDEX(p_index, count + 1);
+
+		if (blocks.is_empty()) {
+			LocalVector<T> *block = memnew(LocalVector<T>);
+			block->reserve(BLOCK_SIZE * 2);
+			blocks.push_back(block);
+			_rebuild_size_tree();
+		}
+
+		// Appending goes to the last block, anything else to the block holding the index.
+		uint32_t offset;
+		uint32_t block;
+		if (p_index == count) {
+			block = blocks.size() - 1;
+			offset = count - blocks[block]->size();
+		} else {
+			block = _find_block(p_index, offset);
+		}
+		blocks[block]->insert(p_index - offset, p_value);
+		count++;
+
+		if (blocks[block]->size() > BLOCK_SIZE * 2) {
+			_split_block(block);
+			_rebuild_size_tree();
+		} else {
+			_add_block_size(block, 1);
+			last_block = block;
+			last_offset = offset;
+		}
+	}
+
+	_FORCE_INLINE_ void push_back(const T &p_value) {
+		insert(count, p_value);
+	}
+
+	void remove_at(int64_t p_index) {
+		ERR_FAIL_INDEX(p_index, count);
+
+		uint32_t offset;
+		const uint32_t block = _find_block(p_index, offset);
+		blocks[block]->remove_at(p_index - offset);
+		count--;
+
+		if (_is_block_too_small(block)) {
+			_merge_block(block);
+		} else {
+			_add_block_size(block, -1);
+		}
+	}
+
+	// Removes the elements in [p_from, p_to).
+	void remove_range(int64_t p_from, int64_t p_to) {
+		ERR_FAIL_COND(p_from < 0 || p_from > p_to);
+		ERR_FAIL_COND(p_to > count);
+		if (p_from == p_to) {
+			return;
+		}
+
+		uint32_t offset;
+		uint32_t block = _find_block(p_from, offset);
+		const uint32_t first_block = block;
+		uint32_t remaining = p_to - p_from;
+		uint32_t local_from = p_from - offset;
+		while (remaining > 0) {
+			LocalVector<T> *items = blocks[block];
+			const uint32_t removed = MIN(remaining, items->size() - local_from);
+			if (removed == items->size()) {
+				_remove_block(block);
+			} else {
+				const uint32_t local_to = local_from + removed;
+				for (uint32_t i = local_to; i < items->size(); i++) {
+					(*items)[i - removed] = (*items)[i];
+				}
+				items->resize(items->size() - removed);
+				block++;
+			}
+			remaining -= removed;
+			count -= removed;
+			local_from = 0;
+		}
+
+		// The first and last blocks of the range may be left small, the last one first so the index of the first stays valid.
+		if (first_block + 1 < blocks.size() && _is_block_too_small(first_block + 1)) {
+			_merge_block(first_block + 1);
+		}
+		if (first_block < blocks.size() && _is_block_too_small(first_block)) {
+			_merge_block(first_block);
+		}
+		_rebuild_size_tree();
+	}
+
+	void clear() {
+		for (LocalVector<T> *block : blocks) {
+			memdelete(block);
+		}
+		blocks.clear();
+		size_tree.clear();
+		size_tree_step = 0;
+		count = 0;
+		last_block = 0;
+		last_offset = 0;
+	}
+
+	template <bool CONST>
+	struct IteratorBase {
+		typedef typename std::conditional<CONST, const BlockVector, BlockVector>::type Owner;
+		typedef typename std::conditional<CONST, const T, T>::type Element;
+
+		_FORCE_INLINE_ Element &operator*() const {
+			return (*owner->blocks[block])[index];
+		}
+		_FORCE_INLINE_ Element *operator->() const { return &(*owner->blocks[block])[index]; }
+		_FORCE_INLINE_ IteratorBase &operator++() {
+			index++;
+			if (index == owner->blocks[block]->size()) {
+				block++;
+				index = 0;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const IteratorBase &b) const { return block == b.block && index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const IteratorBase &b) const { return block != b.block || index != b.index; }
+
+		IteratorBase(Owner *p_owner, uint32_t p_block) {
+			owner = p_owner;
+			block = p_block;
+		}
+
+	private:
+		Owner *owner = nullptr;
+		uint32_t block = 0;
+		uint32_t index = 0;
+	};
+
+	typedef IteratorBase<false> Iterator;
+	typedef IteratorBase<true> ConstIterator;
+
+	_FORCE_INLINE_ Iterator begin() { return Iterator(this, 0); }
+	_FORCE_INLINE_ Iterator end() { return Iterator(this, blocks.size()); }
+	_FORCE_INLINE_ ConstIterator begin() const { return ConstIterator(this, 0); }
+	_FORCE_INLINE_ ConstIterator end() const { return ConstIterator(this, blocks.size()); }
+
+	void operator=(const BlockVector &p_other) {
+		if (this == &p_other) {
+			return;
+		}
+		clear();
+		for (const T &E : p_other) {
+			push_back(E);
+		}
+	}
+
+	BlockVector(const BlockVector &p_other) {
+		*this = p_other;
+	}
+
+	BlockVector() {}
+
+	~BlockVector() {
+		clear();
+	}
+};
+
+#endif // BLOCK_VECTOR_H
@@ -0,0 +1,386 @@
+/**************************************************************************/
+/*  small_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SMALL_HASH_MAP_H
+#define SMALL_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+/**
+ * An insertion-ordered map meant for the many maps that only ever hold a handful of elements.
+ *
+ * Elements are stored contiguously and looked up linearly, so small maps cost a single
+ * allocation and no hashing at all. Once the map grows past INDEX_THRESHOLD elements, a
+ * HashMap from key to element slot is built on the side to keep lookups constant time.
+ *
+ * Erasing keeps the insertion order. Small maps shift the following elements down, large maps
+ * leave a tombstone in the slot instead, and compact the slots once half of them are
+ * tombstones, so erasing stays constant time (amortized). Accessing elements by position is
+ * linear while there are tombstones, iterate instead.
+ * Elements are moved around in memory, so they must be trivially relocatable
+ * (same requirement as LocalVector).
+ */
+
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>,
+		uint32_t INDEX_THRESHOLD = 16>
+class SmallHashMap {
+public:
+	typedef KeyValue<TKey, TValue> Element;
+
+private:
+	Element *elements = nullptr;
+	uint32_t count = 0; // Used slots, including tombstones.
+	uint32_t capacity = 0;
+	HashMap<TKey, uint32_t, Hasher, Comparator> *index = nullptr;
+	// Only used along with the index, one flag per used slot.
+	LocalVector<bool> tombstones;
+	uint32_t tombstone_count = 0;
+
+	_FORCE_INLINE_ bool _is_tombstone(uint32_t p_slot) const {
+		return tombstone_count > 0 && tombstones[p_slot];
+	}
+
+	uint32_t _next_slot(uint32_t p_slot) const {
+		while (p_slot < count && _is_tombstone(p_slot)) {
+			p_slot++;
+		}
+		return p_slot;
+	}
+
+	uint32_t _prev_slot(uint32_t p_slot) const {
+		while (p_slot > 0) {
+			p_slot--;
+			if (!_is_tombstone(p_slot)) {
+				return p_slot;
+			}
+		}
+		return count;
+	}
+
+	int32_t _find(const TKey &p_key) const {
+		if (index) {
+			const uint32_t *pos = index->getptr(p_key);
+			return pos ? int32_t(*pos) : -1;
+		}
+		for (uint32_t i = 0; i < count; i++) {
+			if (Comparator::compare(elements[i].key, p_key)) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	int32_t _slot_to_index(int32_t p_slot) const {
+		if (p_slot == -1 || tombstone_count == 0) {
+			return p_slot;
+		}
+		int32_t pos = 0;
+		for (int32_t i = 0; i < p_slot; i++) {
+			pos += tombstones[i] ? 0 : 1;
+		}
+		return pos;
+	}
+
+	uint32_t _index_to_slot(uint32_t p_index) const {
+		if (tombstone_count == 0) {
+			return p_index;
+		}
+		uint32_t slot = _next_slot(0);
+		for (uint32_t i = 0; i < p_index; i++) {
+			slot = _next_slot(slot + 1);
+		}
+		return slot;
+	}
+
+	void _build_index() {
+		index = memnew((HashMap<TKey, uint32_t, Hasher, Comparator>));
+		index->reserve(capacity);
+		tombstones.resize(count);
+		for (uint32_t i = 0; i < count; i++) {
+			index->insert(elements[i].key, i);
+			tombstones[i] = false;
+		}
+	}
+
+	void _compact() {
+		uint32_t to = 0;
+		for (uint32_t from = 0; from < count; from++) {
+			if (tombstones[from]) {
+				continue;
+			}
+			if (from != to) {
+				memcpy((void *)&elements[to], (void *)&elements[from], sizeof(Element));
+				(*index)[elements[to].key] = to;
+				tombstones[to] = false;
+			}
+			to++;
+		}
+		count = to;
+		tombstones.resize(count);
+		tombstone_count = 0;
+	}
+
+	Element *_insert_new(const TKey &p_key, const TValue &p_value) {
+		if (count == capacity) {
+			if (tombstone_count > 0) {
+				_compact();
+			} else {
+				capacity = MAX(4u, capacity << 1);
+				elements = (Element *)memrealloc(elements, capacity * sizeof(Element));
+				CRASH_COND_MSG(!elements, "Out of memory");
+			}
+		}
+		Element *e = memnew_placement(&elements[count], Element(p_key, p_value));
+		count++;
+		if (index) {
+			index->insert(p_key, count - 1);
+			tombstones.push_back(false);
+		} else if (count > INDEX_THRESHOLD) {
+			_build_index();
+		}
+		return e;
+	}
+
+public:
+	struct Iterator {
+		_FORCE_INLINE_ Element &operator*() const { return map->elements[slot]; }
+		_FORCE_INLINE_ Element *operator->() const { return &map->elements[slot]; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			slot = map->_next_slot(slot + 1);
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			slot = map->_prev_slot(slot);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return slot == b.slot; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return slot != b.slot; }
+
+		_FORCE_INLINE_ explicit operator bool() const { return slot < map->count; }
+
+		_FORCE_INLINE_ Iterator(SmallHashMap *p_map, uint32_t p_slot) :
+				map(p_map), slot(p_slot) {}
+
+	private:
+		SmallHashMap *map = nullptr;
+		uint32_t slot = 0;
+	};
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const Element &operator*() const { return map->elements[slot]; }
+		_FORCE_INLINE_ const Element *operator->() const { return &map->elements[slot]; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			slot = map->_next_slot(slot + 1);
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			slot = map->_prev_slot(slot);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return slot == b.slot; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return slot != b.slot; }
+
+		_FORCE_INLINE_ explicit operator bool() const { return slot < map->count; }
+
+		_FORCE_INLINE_ ConstIterator(const SmallHashMap *p_map, uint32_t p_slot) :
+				map(p_map), slot(p_slot) {}
+
+	private:
+		const SmallHashMap *map = nullptr;
+		uint32_t slot = 0;
+	};
+
+	_FORCE_INLINE_ uint32_t size() const { return count - tombstone_count; }
+	_FORCE_INLINE_ bool is_empty() const { return size() == 0; }
+
+	void clear() {
+		for (uint32_t i = 0; i < count; i++) {
+			if (!_is_tombstone(i)) {
+				elements[i].~Element();
+			}
+		}
+		count = 0;
+		tombstones.reset();
+		tombstone_count = 0;
+		if (index) {
+			memdelete(index);
+			index = nullptr;
+		}
+	}
+
+	void reset() {
+		clear();
+		if (elements) {
+			memfree(elements);
+			elements = nullptr;
+		}
+		capacity = 0;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return _find(p_key) != -1;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		int32_t pos = _find(p_key);
+		return pos == -1 ? nullptr : &elements[pos].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		int32_t pos = _find(p_key);
+		return pos == -1 ? nullptr : &elements[pos].value;
+	}
+
+	// Returns the position of the key in insertion order, or -1.
+	_FORCE_INLINE_ int32_t find_index(const TKey &p_key) const {
+		return _slot_to_index(_find(p_key));
+	}
+
+	_FORCE_INLINE_ Element &get_by_index(uint32_t p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, size());
+		return elements[_index_to_slot(p_index)];
+	}
+
+	_FORCE_INLINE_ const Element &get_by_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, size());
+		return elements[_index_to_slot(p_index)];
+	}
+
+	TValue &insert(const TKey &p_key, const TValue &p_value) {
+		int32_t pos = _find(p_key);
+		if (pos != -1) {
+			elements[pos].value = p_value;
+			return elements[pos].value;
+		}
+		return _insert_new(p_key, p_value)->value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		int32_t pos = _find(p_key);
+		if (pos != -1) {
+			return elements[pos].value;
+		}
+		return _insert_new(p_key, TValue())->value;
+	}
+
+	bool erase(const TKey &p_key) {
+		int32_t pos = _find(p_key);
+		if (pos == -1) {
+			return false;
+		}
+		elements[pos].~Element();
+
+		if (!index) {
+			count--;
+			if (uint32_t(pos) < count) {
+				memmove((void *)&elements[pos], (void *)&elements[pos + 1], (count - pos) * sizeof(Element));
+			}
+			return true;
+		}
+
+		index->erase(p_key);
+		if (uint32_t(pos) == count - 1) {
+			// Erasing the last element (i.e. when clearing from the back), drop the trailing tombstones too.
+			count--;
+			while (count > 0 && tombstones[count - 1]) {
+				count--;
+				tombstone_count--;
+			}
+			tombstones.resize(count);
+		} else {
+			tombstones[pos] = true;
+			tombstone_count++;
+			if (tombstone_count * 2 > count) {
+				_compact();
+			}
+		}
+		return true;
+	}
+
+	// Changes the key of an element, keeping its position.
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) {
+		if (Comparator::compare(p_old_key, p_new_key)) {
+			return true;
+		}
+		ERR_FAIL_COND_V(has(p_new_key), false);
+		int32_t pos = _find(p_old_key);
+		if (pos == -1) {
+			return false;
+		}
+		if (index) {
+			index->erase(p_old_key);
+			index->insert(p_new_key, pos);
+		}
+		TValue value = elements[pos].value;
+		elements[pos].~Element();
+		memnew_placement(&elements[pos], Element(p_new_key, value));
+		return true;
+	}
+
+	/* Iterators, in insertion order */
+
+	_FORCE_INLINE_ Iterator begin() { return Iterator(this, _next_slot(0)); }
+	_FORCE_INLINE_ Iterator end() { return Iterator(this, count); }
+	_FORCE_INLINE_ Iterator last() { return Iterator(this, _prev_slot(count)); }
+	_FORCE_INLINE_ ConstIterator begin() const { return ConstIterator(this, _next_slot(0)); }
+	_FORCE_INLINE_ ConstIterator end() const { return ConstIterator(this, count); }
+	_FORCE_INLINE_ ConstIterator last() const { return ConstIterator(this, _prev_slot(count)); }
+
+	void operator=(const SmallHashMap &p_other) {
+		if (this == &p_other) {
+			return;
+		}
+		clear();
+		for (const Element &E : p_other) {
+			_insert_new(E.key, E.value);
+		}
+	}
+
+	SmallHashMap(const SmallHashMap &p_other) {
+		for (const Element &E : p_other) {
+			_insert_new(E.key, E.value);
+		}
+	}
+
+	SmallHashMap() {}
+
+	~SmallHashMap() {
+		reset();
+	}
+};
+
+#endif // SMALL_HASH_MAP_H
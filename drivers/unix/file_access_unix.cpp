@@ -143,6 +143,8 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	_wait_for_async_reads();
+
 	fclose(f);
 	f = nullptr;
 
@@ -238,6 +240,25 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+uint64_t FileAccessUnix::_read_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) {
+	ERR_FAIL_NULL_V_MSG(f, 0, "File must be opened before use.");
+
+	// pread() doesn't use nor move the stream position, so it can run on another thread.
+	const int fd = fileno(f);
+	uint64_t read = 0;
+	while (read < p_length) {
+		ssize_t ret = pread(fd, p_dst + read, p_length - read, p_offset + read);
+		if (ret < 0 && errno == EINTR) {
+			continue;
+		}
+		if (ret <= 0) {
+			break;
+		}
+		read += ret;
+	}
+	return read;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -52,6 +52,9 @@ class FileAccessUnix : public FileAccess {
 
 	void _close();
 
+protected:
+	virtual uint64_t _read_at(uint64_t p_offset, uint8_t *p_dst, uint64_t p_length) override;
+
 public:
 	static CloseNotificationFunc close_notification_func;
 
@@ -71,6 +74,8 @@ public:
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
 
+	virtual bool can_read_async() const override { return f && flags == READ; }
+
 	virtual Error get_error() const override; ///< get last error
 
 	virtual void flush() override;
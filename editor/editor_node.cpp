@@ -1145,7 +1145,7 @@ void EditorNode::save_resource_in_path(const Ref<Resource> &p_resource, const St
 	}
 
 	String path = ProjectSettings::get_singleton()->localize_path(p_path);
-	Error err = ResourceSaver::save(p_resource, path, flg | ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS);
+	Error err = ResourceSaver::save(p_resource, path, flg | ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS | ResourceSaver::FLAG_INCREMENTAL);
 
 	if (err != OK) {
 		if (ResourceLoader::is_imported(p_resource->get_path())) {
@@ -1573,6 +1573,8 @@ int EditorNode::_save_external_resources() {
 		flg |= ResourceSaver::FLAG_COMPRESS;
 	}
 	flg |= ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS;
+	// Scenes are saved often, only encode what changed since the last save.
+	flg |= ResourceSaver::FLAG_INCREMENTAL;
 
 	HashSet<String> edited_resources;
 	int saved = 0;
@@ -1685,6 +1687,7 @@ void EditorNode::_save_scene(String p_file, int idx) {
 		flg |= ResourceSaver::FLAG_COMPRESS;
 	}
 	flg |= ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS;
+	flg |= ResourceSaver::FLAG_INCREMENTAL;
 
 	err = ResourceSaver::save(sdata, p_file, flg);
 
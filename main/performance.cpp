@@ -36,8 +36,10 @@
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/main/viewport.h"
 #include "servers/audio_server.h"
 #include "servers/rendering_server.h"
+#include "servers/text_server.h"
 
 Performance *Performance::singleton = nullptr;
 
@@ -67,6 +69,10 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDER_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDER_BUFFER_MEM_USED);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_TIME);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_CONTROL_COUNT);
+	BIND_ENUM_CONSTANT(TEXT_GLYPH_CACHE_MEMORY);
+	BIND_ENUM_CONSTANT(TEXT_GLYPH_CACHE_EVICTIONS);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -99,6 +105,10 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"video/texture_mem",
 		"video/buffer_mem",
 		"audio/driver/output_latency",
+		"gui/layout_time",
+		"gui/layout_controls",
+		"text/glyph_cache_mem",
+		"text/glyph_cache_evictions",
 	};
 
 	return names[p_monitor];
@@ -140,6 +150,14 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_BUFFER_MEM_USED);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case GUI_LAYOUT_TIME:
+			return Viewport::gui_layout_stats_last_frame.time_usec / 1000000.0;
+		case GUI_LAYOUT_CONTROL_COUNT:
+			return Viewport::gui_layout_stats_last_frame.control_count;
+		case TEXT_GLYPH_CACHE_MEMORY:
+			return TS->font_get_global_glyph_cache_memory();
+		case TEXT_GLYPH_CACHE_EVICTIONS:
+			return TS->font_get_global_glyph_cache_eviction_count();
 		default: {
 		}
 	}
@@ -168,6 +186,10 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
 	};
 
 	return types[p_monitor];
@@ -84,6 +84,10 @@ public:
 		RENDER_TEXTURE_MEM_USED,
 		RENDER_BUFFER_MEM_USED,
 		AUDIO_OUTPUT_LATENCY,
+		GUI_LAYOUT_TIME,
+		GUI_LAYOUT_CONTROL_COUNT,
+		TEXT_GLYPH_CACHE_MEMORY,
+		TEXT_GLYPH_CACHE_EVICTIONS,
 		MONITOR_MAX
 	};
 
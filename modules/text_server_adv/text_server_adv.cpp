@@ -951,7 +951,7 @@ void TextServerAdvanced::_generateMTSDF_threaded(void *p_td, uint32_t p_y) {
 	}
 }
 
-_FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance) const {
+_FORCE_INLINE_ void TextServerAdvanced::rasterize_msdf(int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance, bool p_threaded, GlyphImage &r_image) const {
 	msdfgen::Shape shape;
 
 	shape.contours.clear();
@@ -968,7 +968,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 	ft_functions.delta = 0;
 
 	int error = FT_Outline_Decompose(outline, &ft_functions, &context);
-	ERR_FAIL_COND_V_MSG(error, FontGlyph(), "FreeType: Outline decomposition error: '" + String(FT_Error_String(error)) + "'.");
+	ERR_FAIL_COND_MSG(error, "FreeType: Outline decomposition error: '" + String(FT_Error_String(error)) + "'.");
 	if (!shape.contours.empty() && shape.contours.back().edges.empty()) {
 		shape.contours.pop_back();
 	}
@@ -984,9 +984,9 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 
 	msdfgen::Shape::Bounds bounds = shape.getBounds(p_pixel_range);
 
-	FontGlyph chr;
-	chr.found = true;
-	chr.advance = advance;
+	r_image.found = true;
+	r_image.msdf = true;
+	r_image.advance = advance;
 
 	if (shape.validate() && shape.contours.size() > 0) {
 		int w = (bounds.r - bounds.l);
@@ -995,12 +995,9 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 		int mw = w + p_rect_margin * 4;
 		int mh = h + p_rect_margin * 4;
 
-		ERR_FAIL_COND_V(mw > 4096, FontGlyph());
-		ERR_FAIL_COND_V(mh > 4096, FontGlyph());
-
-		FontTexturePosition tex_pos = find_texture_pos_for_glyph(p_data, 4, Image::FORMAT_RGBA8, mw, mh, true);
-		ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
-		ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
+		r_image.found = (mw <= 4096 && mh <= 4096);
+		ERR_FAIL_COND(mw > 4096);
+		ERR_FAIL_COND(mh > 4096);
 
 		edgeColoringSimple(shape, 3.0); // Max. angle.
 		msdfgen::Bitmap<float, 4> image(w, h); // Texture size.
@@ -1015,18 +1012,30 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 		td.projection = &projection;
 		td.distancePixelConversion = &distancePixelConversion;
 
-		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_generateMTSDF_threaded, &td, h, -1, true, String("FontServerRasterizeMSDF"));
-		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		if (p_threaded) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_generateMTSDF_threaded, &td, h, -1, true, String("FontServerRasterizeMSDF"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			// Already running on a worker thread, see _ensure_glyphs().
+			for (int i = 0; i < h; i++) {
+				_generateMTSDF_threaded(&td, i);
+			}
+		}
 
 		msdfgen::msdfErrorCorrection(image, shape, projection, p_pixel_range, config);
 
+		r_image.has_image = true;
+		r_image.width = w;
+		r_image.height = h;
+		r_image.color_size = 4;
+		r_image.format = Image::FORMAT_RGBA8;
+		r_image.data.resize(w * h * 4);
 		{
-			uint8_t *wr = tex.imgdata.ptrw();
+			uint8_t *wr = r_image.data.ptrw();
 
 			for (int i = 0; i < h; i++) {
 				for (int j = 0; j < w; j++) {
-					int ofs = ((i + tex_pos.y + p_rect_margin * 2) * tex.texture_w + j + tex_pos.x + p_rect_margin * 2) * 4;
-					ERR_FAIL_COND_V(ofs >= tex.imgdata.size(), FontGlyph());
+					int ofs = (i * w + j) * 4;
 					wr[ofs + 0] = (uint8_t)(CLAMP(image(j, i)[0] * 256.f, 0.f, 255.f));
 					wr[ofs + 1] = (uint8_t)(CLAMP(image(j, i)[1] * 256.f, 0.f, 255.f));
 					wr[ofs + 2] = (uint8_t)(CLAMP(image(j, i)[2] * 256.f, 0.f, 255.f));
@@ -1035,21 +1044,13 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 			}
 		}
 
-		tex.dirty = true;
-
-		chr.texture_idx = tex_pos.index;
-
-		chr.uv_rect = Rect2(tex_pos.x + p_rect_margin, tex_pos.y + p_rect_margin, w + p_rect_margin * 2, h + p_rect_margin * 2);
-		chr.rect.position = Vector2(bounds.l - p_rect_margin, -bounds.t - p_rect_margin);
-
-		chr.rect.size = chr.uv_rect.size;
+		r_image.offset = Vector2(bounds.l, -bounds.t);
 	}
-	return chr;
 }
 #endif
 
 #ifdef MODULE_FREETYPE_ENABLED
-_FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap bitmap, int yofs, int xofs, const Vector2 &advance, bool p_bgra) const {
+_FORCE_INLINE_ void TextServerAdvanced::rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap bitmap, int yofs, int xofs, const Vector2 &advance, bool p_bgra, GlyphImage &r_image) const {
 	int w = bitmap.width;
 	int h = bitmap.rows;
 	int color_size = 2;
@@ -1075,24 +1076,16 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitma
 	int mw = w + p_rect_margin * 4;
 	int mh = h + p_rect_margin * 4;
 
-	ERR_FAIL_COND_V(mw > 4096, FontGlyph());
-	ERR_FAIL_COND_V(mh > 4096, FontGlyph());
-
-	Image::Format require_format = color_size == 4 ? Image::FORMAT_RGBA8 : Image::FORMAT_LA8;
-
-	FontTexturePosition tex_pos = find_texture_pos_for_glyph(p_data, color_size, require_format, mw, mh, false);
-	ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
-
-	// Fit character in char texture.
-	ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
+	ERR_FAIL_COND(mw > 4096);
+	ERR_FAIL_COND(mh > 4096);
 
+	r_image.data.resize(w * h * color_size);
 	{
-		uint8_t *wr = tex.imgdata.ptrw();
+		uint8_t *wr = r_image.data.ptrw();
 
 		for (int i = 0; i < h; i++) {
 			for (int j = 0; j < w; j++) {
-				int ofs = ((i + tex_pos.y + p_rect_margin * 2) * tex.texture_w + j + tex_pos.x + p_rect_margin * 2) * color_size;
-				ERR_FAIL_COND_V(ofs >= tex.imgdata.size(), FontGlyph());
+				int ofs = (i * w + j) * color_size;
 				switch (bitmap.pixel_mode) {
 					case FT_PIXEL_MODE_MONO: {
 						int byte = i * bitmap.pitch + (j >> 3);
@@ -1140,31 +1133,213 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitma
 						}
 					} break;
 					default:
-						ERR_FAIL_V_MSG(FontGlyph(), "Font uses unsupported pixel format: " + String::num_int64(bitmap.pixel_mode) + ".");
+						r_image.data.clear();
+						ERR_FAIL_MSG("Font uses unsupported pixel format: " + String::num_int64(bitmap.pixel_mode) + ".");
 						break;
 				}
 			}
 		}
 	}
 
-	tex.dirty = true;
+	r_image.found = true;
+	r_image.has_image = true;
+	r_image.width = w;
+	r_image.height = h;
+	r_image.color_size = color_size;
+	r_image.format = color_size == 4 ? Image::FORMAT_RGBA8 : Image::FORMAT_LA8;
+	r_image.offset = Vector2(xofs, -yofs);
+	r_image.scale = p_data->scale / p_data->oversampling;
+	r_image.advance = advance * r_image.scale;
+}
+#endif
 
+TextServerAdvanced::FontGlyph TextServerAdvanced::_insert_glyph_image(FontForSizeAdvanced *p_data, int p_rect_margin, const GlyphImage &p_image) const {
 	FontGlyph chr;
-	chr.advance = advance * p_data->scale / p_data->oversampling;
+	chr.found = p_image.found;
+	chr.advance = p_image.advance;
+	if (!p_image.found || !p_image.has_image) {
+		return chr;
+	}
+
+	int w = p_image.width;
+	int h = p_image.height;
+	int mw = w + p_rect_margin * 4;
+	int mh = h + p_rect_margin * 4;
+
+	FontTexturePosition tex_pos = find_texture_pos_for_glyph(p_data, p_image.color_size, p_image.format, mw, mh, p_image.msdf);
+	ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
+
+	// Fit character in char texture.
+	ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
+
+	{
+		uint8_t *wr = tex.imgdata.ptrw();
+		const uint8_t *rd = p_image.data.ptr();
+		int row_size = w * p_image.color_size;
+
+		for (int i = 0; i < h && row_size > 0; i++) {
+			int ofs = ((i + tex_pos.y + p_rect_margin * 2) * tex.texture_w + tex_pos.x + p_rect_margin * 2) * p_image.color_size;
+			ERR_FAIL_COND_V(ofs + row_size > tex.imgdata.size(), FontGlyph());
+			memcpy(wr + ofs, rd + i * row_size, row_size);
+		}
+	}
+
+	tex.dirty = true;
+
 	chr.texture_idx = tex_pos.index;
-	chr.found = true;
 
 	chr.uv_rect = Rect2(tex_pos.x + p_rect_margin, tex_pos.y + p_rect_margin, w + p_rect_margin * 2, h + p_rect_margin * 2);
-	chr.rect.position = Vector2(xofs - p_rect_margin, -yofs - p_rect_margin) * p_data->scale / p_data->oversampling;
-	chr.rect.size = chr.uv_rect.size * p_data->scale / p_data->oversampling;
+	chr.rect.position = (p_image.offset - Vector2(p_rect_margin, p_rect_margin)) * p_image.scale;
+	chr.rect.size = chr.uv_rect.size * p_image.scale;
 	return chr;
 }
-#endif
 
 /*************************************************************************/
 /* Font Cache                                                            */
 /*************************************************************************/
 
+#ifdef MODULE_FREETYPE_ENABLED
+void TextServerAdvanced::_rasterize_glyph(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, FT_Face p_face, const Vector2i &p_size, int32_t p_glyph, bool p_threaded_msdf, GlyphImage &r_image) const {
+	int32_t glyph_index = p_glyph & 0xffffff; // Remove subpixel shifts.
+	r_image.rasterized = true;
+
+	FT_Int32 flags = FT_LOAD_DEFAULT;
+
+	bool outline = p_size.y > 0;
+	switch (p_font_data->hinting) {
+		case TextServer::HINTING_NONE:
+			flags |= FT_LOAD_NO_HINTING;
+			break;
+		case TextServer::HINTING_LIGHT:
+			flags |= FT_LOAD_TARGET_LIGHT;
+			break;
+		default:
+			flags |= FT_LOAD_TARGET_NORMAL;
+			break;
+	}
+	if (p_font_data->force_autohinter) {
+		flags |= FT_LOAD_FORCE_AUTOHINT;
+	}
+	if (outline) {
+		flags |= FT_LOAD_NO_BITMAP;
+	} else if (FT_HAS_COLOR(p_face)) {
+		flags |= FT_LOAD_COLOR;
+	}
+
+	FT_Fixed v, h;
+	FT_Get_Advance(p_face, glyph_index, flags, &h);
+	FT_Get_Advance(p_face, glyph_index, flags | FT_LOAD_VERTICAL_LAYOUT, &v);
+
+	int error = FT_Load_Glyph(p_face, glyph_index, flags);
+	if (error) {
+		return;
+	}
+
+	if (!p_font_data->msdf) {
+		if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+			FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 4;
+			FT_Outline_Translate(&p_face->glyph->outline, xshift, 0);
+		} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+			FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 5;
+			FT_Outline_Translate(&p_face->glyph->outline, xshift, 0);
+		}
+	}
+
+	if (p_font_data->embolden != 0.f) {
+		FT_Pos strength = p_font_data->embolden * p_size.x * 4; // 26.6 fractional units (1 / 64).
+		FT_Outline_Embolden(&p_face->glyph->outline, strength);
+	}
+
+	if (p_font_data->transform != Transform2D()) {
+		FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
+		FT_Outline_Transform(&p_face->glyph->outline, &mat);
+	}
+
+	FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
+	bool bgra = false;
+	switch (p_font_data->antialiasing) {
+		case FONT_ANTIALIASING_NONE: {
+			aa_mode = FT_RENDER_MODE_MONO;
+		} break;
+		case FONT_ANTIALIASING_GRAY: {
+			aa_mode = FT_RENDER_MODE_NORMAL;
+		} break;
+		case FONT_ANTIALIASING_LCD: {
+			int aa_layout = (int)((p_glyph >> 24) & 7);
+			switch (aa_layout) {
+				case FONT_LCD_SUBPIXEL_LAYOUT_HRGB: {
+					aa_mode = FT_RENDER_MODE_LCD;
+					bgra = false;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_HBGR: {
+					aa_mode = FT_RENDER_MODE_LCD;
+					bgra = true;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_VRGB: {
+					aa_mode = FT_RENDER_MODE_LCD_V;
+					bgra = false;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_VBGR: {
+					aa_mode = FT_RENDER_MODE_LCD_V;
+					bgra = true;
+				} break;
+				default: {
+					aa_mode = FT_RENDER_MODE_NORMAL;
+				} break;
+			}
+		} break;
+	}
+
+	if (!outline) {
+		if (!p_font_data->msdf) {
+			error = FT_Render_Glyph(p_face->glyph, aa_mode);
+		}
+		FT_GlyphSlot slot = p_face->glyph;
+		if (!error) {
+			if (p_font_data->msdf) {
+#ifdef MODULE_MSDFGEN_ENABLED
+				rasterize_msdf(p_font_data->msdf_range, rect_range, &slot->outline, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0, p_threaded_msdf, r_image);
+#else
+				ERR_FAIL_MSG("Compiled without MSDFGEN support!");
+#endif
+			} else {
+				rasterize_bitmap(p_data, rect_range, slot->bitmap, slot->bitmap_top, slot->bitmap_left, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0, bgra, r_image);
+			}
+		}
+	} else {
+		FT_Stroker stroker;
+		if (FT_Stroker_New(ft_library, &stroker) != 0) {
+			ERR_FAIL_MSG("FreeType: Failed to load glyph stroker.");
+		}
+		FT_Stroker_LineCap_ line_cap = (FT_Stroker_LineCap_)(GLOBAL_GET("gui/fonts/dynamic_fonts/line_cap").operator int());
+		FT_Stroker_LineJoin_ line_join = (FT_Stroker_LineJoin_)(GLOBAL_GET("gui/fonts/dynamic_fonts/line_join").operator int());
+		int radius = (int)(p_data->size.y * p_data->oversampling * 64.0);
+		FT_Fixed miter_limit = (FT_Fixed)((GLOBAL_GET("gui/fonts/dynamic_fonts/miter_limit").operator float() * 16.6) * radius);
+
+		FT_Stroker_Set(stroker, radius, line_cap, line_join, miter_limit);
+		FT_Glyph glyph;
+		FT_BitmapGlyph glyph_bitmap;
+
+		if (FT_Get_Glyph(p_face->glyph, &glyph) != 0) {
+			goto cleanup_stroker;
+		}
+		if (FT_Glyph_Stroke(&glyph, stroker, 1) != 0) {
+			goto cleanup_glyph;
+		}
+		if (FT_Glyph_To_Bitmap(&glyph, aa_mode, nullptr, 1) != 0) {
+			goto cleanup_glyph;
+		}
+		glyph_bitmap = (FT_BitmapGlyph)glyph;
+		rasterize_bitmap(p_data, rect_range, glyph_bitmap->bitmap, glyph_bitmap->top, glyph_bitmap->left, Vector2(), bgra, r_image);
+
+	cleanup_glyph:
+		FT_Done_Glyph(glyph);
+	cleanup_stroker:
+		FT_Stroker_Done(stroker);
+	}
+}
+#endif
+
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const {
 	ERR_FAIL_COND_V(!_ensure_cache_for_size(p_font_data, p_size), false);
 
@@ -1181,161 +1356,179 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 	}
 
 #ifdef MODULE_FREETYPE_ENABLED
-	FontGlyph gl;
 	if (fd->face) {
-		FT_Int32 flags = FT_LOAD_DEFAULT;
+		GlyphImage image;
+		_rasterize_glyph(p_font_data, fd, fd->face, p_size, p_glyph, true, image);
+		FontGlyph gl = _insert_glyph_image(fd, rect_range, image);
+		fd->glyph_map[p_glyph] = gl;
+		return gl.found;
+	}
+#endif
+	fd->glyph_map[p_glyph] = FontGlyph();
+	return false;
+}
 
-		bool outline = p_size.y > 0;
-		switch (p_font_data->hinting) {
-			case TextServer::HINTING_NONE:
-				flags |= FT_LOAD_NO_HINTING;
-				break;
-			case TextServer::HINTING_LIGHT:
-				flags |= FT_LOAD_TARGET_LIGHT;
-				break;
-			default:
-				flags |= FT_LOAD_TARGET_NORMAL;
-				break;
-		}
-		if (p_font_data->force_autohinter) {
-			flags |= FT_LOAD_FORCE_AUTOHINT;
-		}
-		if (outline) {
-			flags |= FT_LOAD_NO_BITMAP;
-		} else if (FT_HAS_COLOR(fd->face)) {
-			flags |= FT_LOAD_COLOR;
-		}
+#ifdef MODULE_FREETYPE_ENABLED
+void TextServerAdvanced::_rasterize_glyphs_threaded(void *p_td, uint32_t p_batch) {
+	GlyphBatch *td = static_cast<GlyphBatch *>(p_td);
+	const TextServerAdvanced *ts = td->server;
+	FontForSizeAdvanced *ffsd = td->size_data;
+
+	int from = p_batch * td->batch_size;
+	int to = MIN(from + td->batch_size, td->count);
+	if (from >= to) {
+		return;
+	}
 
-		FT_Fixed v, h;
-		FT_Get_Advance(fd->face, glyph_index, flags, &h);
-		FT_Get_Advance(fd->face, glyph_index, flags | FT_LOAD_VERTICAL_LAYOUT, &v);
+	// FreeType faces can't be used by multiple threads at once, each batch opens its own.
+	FT_Face face = nullptr;
+	{
+		MutexLock ftlock(ts->ft_mutex);
 
-		int error = FT_Load_Glyph(fd->face, glyph_index, flags);
-		if (error) {
-			fd->glyph_map[p_glyph] = FontGlyph();
-			return false;
-		}
+		FT_Open_Args fargs;
+		memset(&fargs, 0, sizeof(FT_Open_Args));
+		fargs.memory_base = (unsigned char *)td->font_data->data_ptr;
+		fargs.memory_size = td->font_data->data_size;
+		fargs.flags = FT_OPEN_MEMORY;
 
-		if (!p_font_data->msdf) {
-			if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-				FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 4;
-				FT_Outline_Translate(&fd->face->glyph->outline, xshift, 0);
-			} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-				FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 5;
-				FT_Outline_Translate(&fd->face->glyph->outline, xshift, 0);
+		if (FT_Open_Face(ts->ft_library, &fargs, td->face_index, &face) != 0) {
+			if (face) {
+				FT_Done_Face(face);
 			}
+			return; // Glyphs of this batch are left to _ensure_glyph().
 		}
+	}
 
-		if (p_font_data->embolden != 0.f) {
-			FT_Pos strength = p_font_data->embolden * p_size.x * 4; // 26.6 fractional units (1 / 64).
-			FT_Outline_Embolden(&fd->face->glyph->outline, strength);
-		}
-
-		if (p_font_data->transform != Transform2D()) {
-			FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
-			FT_Outline_Transform(&fd->face->glyph->outline, &mat);
-		}
+	if (td->strike_index >= 0) {
+		FT_Select_Size(face, td->strike_index);
+	} else {
+		FT_Set_Pixel_Sizes(face, 0, double(ffsd->size.x * ffsd->oversampling));
+	}
+	if (!td->var_coords.is_empty()) {
+		FT_Set_Var_Design_Coordinates(face, td->var_coords.size(), (FT_Fixed *)td->var_coords.ptr());
+	}
 
-		FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
-		bool bgra = false;
-		switch (p_font_data->antialiasing) {
-			case FONT_ANTIALIASING_NONE: {
-				aa_mode = FT_RENDER_MODE_MONO;
-			} break;
-			case FONT_ANTIALIASING_GRAY: {
-				aa_mode = FT_RENDER_MODE_NORMAL;
-			} break;
-			case FONT_ANTIALIASING_LCD: {
-				int aa_layout = (int)((p_glyph >> 24) & 7);
-				switch (aa_layout) {
-					case FONT_LCD_SUBPIXEL_LAYOUT_HRGB: {
-						aa_mode = FT_RENDER_MODE_LCD;
-						bgra = false;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_HBGR: {
-						aa_mode = FT_RENDER_MODE_LCD;
-						bgra = true;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_VRGB: {
-						aa_mode = FT_RENDER_MODE_LCD_V;
-						bgra = false;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_VBGR: {
-						aa_mode = FT_RENDER_MODE_LCD_V;
-						bgra = true;
-					} break;
-					default: {
-						aa_mode = FT_RENDER_MODE_NORMAL;
-					} break;
-				}
-			} break;
-		}
+	for (int i = from; i < to; i++) {
+		ts->_rasterize_glyph(td->font_data, ffsd, face, td->size, td->glyphs[i], false, td->images[i]);
+	}
 
-		if (!outline) {
-			if (!p_font_data->msdf) {
-				error = FT_Render_Glyph(fd->face->glyph, aa_mode);
-			}
-			FT_GlyphSlot slot = fd->face->glyph;
-			if (!error) {
-				if (p_font_data->msdf) {
-#ifdef MODULE_MSDFGEN_ENABLED
-					gl = rasterize_msdf(p_font_data, fd, p_font_data->msdf_range, rect_range, &slot->outline, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0);
-#else
-					fd->glyph_map[p_glyph] = FontGlyph();
-					ERR_FAIL_V_MSG(false, "Compiled without MSDFGEN support!");
+	MutexLock ftlock(ts->ft_mutex);
+	FT_Done_Face(face);
+}
 #endif
-				} else {
-					gl = rasterize_bitmap(fd, rect_range, slot->bitmap, slot->bitmap_top, slot->bitmap_left, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0, bgra);
+
+void TextServerAdvanced::_ensure_glyphs(FontAdvanced *p_font_data, const Vector2i &p_size, const Vector<int32_t> &p_glyphs) const {
+	ERR_FAIL_COND(!_ensure_cache_for_size(p_font_data, p_size));
+
+	// Most calls only use cached glyphs, check for that before allocating anything.
+	FontForSizeAdvanced *fd = p_font_data->cache[p_size];
+	const int32_t *glyphs_ptr = p_glyphs.ptr();
+	int first_missing = 0;
+	while (first_missing < p_glyphs.size() && fd->glyph_map.has(glyphs_ptr[first_missing])) {
+		first_missing++;
+	}
+	if (first_missing == p_glyphs.size()) {
+		return;
+	}
+
+#ifdef MODULE_FREETYPE_ENABLED
+	if (fd->face && p_glyphs.size() - first_missing >= glyph_batch_size * 2) {
+		Vector<int32_t> missing;
+		HashSet<int32_t> queued;
+		for (int i = first_missing; i < p_glyphs.size(); i++) {
+			const int32_t glyph = glyphs_ptr[i];
+			if ((glyph & 0xffffff) != 0 && !fd->glyph_map.has(glyph) && !queued.has(glyph)) {
+				queued.insert(glyph);
+				missing.push_back(glyph);
+			}
+		}
+
+		// Split in at least two batches even on a single core, so the path taken doesn't depend on the core count.
+		int thread_count = MIN(MAX(OS::get_singleton()->get_processor_count(), 2), missing.size() / glyph_batch_size);
+		if (thread_count > 1) {
+			// Rasterize new glyphs on worker threads, then pack them into the textures in the requested order.
+			Vector<GlyphImage> images;
+			images.resize(missing.size());
+
+			GlyphBatch td;
+			td.server = this;
+			td.font_data = p_font_data;
+			td.size_data = fd;
+			td.size = p_size;
+			td.face_index = fd->face->face_index;
+			if (FT_HAS_COLOR(fd->face) && fd->face->num_fixed_sizes > 0) {
+				// Same strike as selected by _ensure_cache_for_size().
+				td.strike_index = 0;
+				int diff = ABS(fd->size.x - ((int64_t)fd->face->available_sizes[0].width));
+				for (int i = 1; i < fd->face->num_fixed_sizes; i++) {
+					int ndiff = ABS(fd->size.x - ((int64_t)fd->face->available_sizes[i].width));
+					if (ndiff < diff) {
+						td.strike_index = i;
+						diff = ndiff;
+					}
 				}
 			}
-		} else {
-			FT_Stroker stroker;
-			if (FT_Stroker_New(ft_library, &stroker) != 0) {
-				fd->glyph_map[p_glyph] = FontGlyph();
-				ERR_FAIL_V_MSG(false, "FreeType: Failed to load glyph stroker.");
+			if (fd->face->face_flags & FT_FACE_FLAG_MULTIPLE_MASTERS) {
+				FT_MM_Var *amaster;
+				FT_Get_MM_Var(fd->face, &amaster);
+				td.var_coords.resize(amaster->num_axis);
+				FT_Get_Var_Design_Coordinates(fd->face, td.var_coords.size(), td.var_coords.ptrw());
+				FT_Done_MM_Var(ft_library, amaster);
 			}
-			FT_Stroker_LineCap_ line_cap = (FT_Stroker_LineCap_)(GLOBAL_GET("gui/fonts/dynamic_fonts/line_cap").operator int());
-			FT_Stroker_LineJoin_ line_join = (FT_Stroker_LineJoin_)(GLOBAL_GET("gui/fonts/dynamic_fonts/line_join").operator int());
-			int radius = (int)(fd->size.y * fd->oversampling * 64.0);
-			FT_Fixed miter_limit = (FT_Fixed)((GLOBAL_GET("gui/fonts/dynamic_fonts/miter_limit").operator float() * 16.6) * radius);
+			td.glyphs = missing.ptr();
+			td.images = images.ptrw();
+			td.count = missing.size();
+			td.batch_size = (missing.size() + thread_count - 1) / thread_count;
 
-			FT_Stroker_Set(stroker, radius, line_cap, line_join, miter_limit);
-			FT_Glyph glyph;
-			FT_BitmapGlyph glyph_bitmap;
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_rasterize_glyphs_threaded, &td, thread_count, -1, true, String("FontServerRasterizeGlyphs"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
-			if (FT_Get_Glyph(fd->face->glyph, &glyph) != 0) {
-				goto cleanup_stroker;
-			}
-			if (FT_Glyph_Stroke(&glyph, stroker, 1) != 0) {
-				goto cleanup_glyph;
-			}
-			if (FT_Glyph_To_Bitmap(&glyph, aa_mode, nullptr, 1) != 0) {
-				goto cleanup_glyph;
+			for (int i = 0; i < missing.size(); i++) {
+				if (images[i].rasterized) {
+					fd->glyph_map[missing[i]] = _insert_glyph_image(fd, rect_range, images[i]);
+				}
 			}
-			glyph_bitmap = (FT_BitmapGlyph)glyph;
-			gl = rasterize_bitmap(fd, rect_range, glyph_bitmap->bitmap, glyph_bitmap->top, glyph_bitmap->left, Vector2(), bgra);
-
-		cleanup_glyph:
-			FT_Done_Glyph(glyph);
-		cleanup_stroker:
-			FT_Stroker_Done(stroker);
 		}
-		fd->glyph_map[p_glyph] = gl;
-		return gl.found;
 	}
 #endif
-	fd->glyph_map[p_glyph] = FontGlyph();
-	return false;
+
+	// Glyphs rendered above are already cached, the rest is rasterized one by one.
+	for (int i = first_missing; i < p_glyphs.size(); i++) {
+		_ensure_glyph(p_font_data, p_size, glyphs_ptr[i]);
+	}
+}
+
+void TextServerAdvanced::_get_glyph_variants(const FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index, Vector<int32_t> &r_glyphs) const {
+	if (p_font_data->msdf) {
+		r_glyphs.push_back(p_index);
+		return;
+	}
+	for (int aa = 0; aa < ((p_font_data->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
+		if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+			r_glyphs.push_back(p_index | (0 << 27) | (aa << 24));
+			r_glyphs.push_back(p_index | (1 << 27) | (aa << 24));
+			r_glyphs.push_back(p_index | (2 << 27) | (aa << 24));
+			r_glyphs.push_back(p_index | (3 << 27) | (aa << 24));
+		} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+			r_glyphs.push_back(p_index | (1 << 27) | (aa << 24));
+			r_glyphs.push_back(p_index | (0 << 27) | (aa << 24));
+		} else {
+			r_glyphs.push_back(p_index | (aa << 24));
+		}
+	}
 }
 
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const {
 	ERR_FAIL_COND_V(p_size.x <= 0, false);
-	if (p_font_data->cache.has(p_size)) {
+	HashMap<Vector2i, FontForSizeAdvanced *, VariantHasher, VariantComparator>::Iterator E = p_font_data->cache.find(p_size);
+	if (E) {
+		E->value->last_used = glyph_cache_epoch.load(std::memory_order_relaxed);
 		return true;
 	}
 
 	FontForSizeAdvanced *fd = memnew(FontForSizeAdvanced);
 	fd->size = p_size;
+	fd->last_used = glyph_cache_epoch.load(std::memory_order_relaxed);
 	if (p_font_data->data_ptr && (p_font_data->data_size > 0)) {
 		// Init dynamic font.
 #ifdef MODULE_FREETYPE_ENABLED
@@ -3451,30 +3644,16 @@ void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2
 	MutexLock lock(fd->mutex);
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
-	for (int64_t i = p_start; i <= p_end; i++) {
 #ifdef MODULE_FREETYPE_ENABLED
-		int32_t idx = FT_Get_Char_Index(fd->cache[size]->face, i);
-		if (fd->cache[size]->face) {
-			if (fd->msdf) {
-				_ensure_glyph(fd, size, (int32_t)idx);
-			} else {
-				for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					} else {
-						_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-					}
-				}
-			}
+	if (fd->cache[size]->face) {
+		Vector<int32_t> glyphs;
+		for (int64_t i = p_start; i <= p_end; i++) {
+			int32_t idx = FT_Get_Char_Index(fd->cache[size]->face, i);
+			_get_glyph_variants(fd, size, idx, glyphs);
 		}
-#endif
+		_ensure_glyphs(fd, size, glyphs);
 	}
+#endif
 }
 
 void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) {
@@ -3487,22 +3666,10 @@ void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 	int32_t idx = p_index & 0xffffff; // Remove subpixel shifts.
 	if (fd->cache[size]->face) {
-		if (fd->msdf) {
-			_ensure_glyph(fd, size, (int32_t)idx);
-		} else {
-			for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-				if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-				} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-				} else {
-					_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-				}
-			}
+		Vector<int32_t> glyphs;
+		_get_glyph_variants(fd, size, idx, glyphs);
+		for (const int32_t &glyph : glyphs) {
+			_ensure_glyph(fd, size, glyph);
 		}
 	}
 #endif
@@ -3515,6 +3682,7 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 	MutexLock lock(fd->mutex);
 	Vector2i size = _get_size(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
+	fd->cache[size]->add_canvas_item(p_canvas);
 
 	int32_t index = p_index & 0xffffff; // Remove subpixel shifts.
 	bool lcd_aa = false;
@@ -3619,6 +3787,7 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 	MutexLock lock(fd->mutex);
 	Vector2i size = _get_size_outline(fd, Vector2i(p_size, p_outline_size));
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
+	fd->cache[size]->add_canvas_item(p_canvas);
 
 	int32_t index = p_index & 0xffffff; // Remove subpixel shifts.
 	bool lcd_aa = false;
@@ -3880,6 +4049,141 @@ void TextServerAdvanced::_font_set_global_oversampling(double p_oversampling) {
 	}
 }
 
+int64_t TextServerAdvanced::_font_get_global_glyph_cache_memory() const {
+	_THREAD_SAFE_METHOD_
+	int64_t memory = 0;
+
+	List<RID> fonts;
+	font_owner.get_owned_list(&fonts);
+	for (const RID &E : fonts) {
+		FontAdvanced *fd = font_owner.get_or_null(E);
+		MutexLock lock(fd->mutex);
+		for (const KeyValue<Vector2i, FontForSizeAdvanced *> &F : fd->cache) {
+			memory += F.value->get_texture_memory();
+		}
+	}
+	return memory;
+}
+
+int64_t TextServerAdvanced::_font_get_global_glyph_cache_eviction_count() const {
+	return glyph_cache_evictions.get();
+}
+
+TypedArray<RID> TextServerAdvanced::_font_trim_global_glyph_cache(int64_t p_max_memory) {
+	_THREAD_SAFE_METHOD_
+	uint64_t epoch = glyph_cache_epoch.fetch_add(1, std::memory_order_relaxed);
+
+	// Glyphs of live shaped text are kept, as they are drawn again without being shaped again.
+	HashMap<const FontAdvanced *, HashSet<int32_t>> shaped_sizes;
+	List<RID> shaped;
+	shaped_owner.get_owned_list(&shaped);
+	for (const RID &E : shaped) {
+		ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(E);
+		MutexLock lock(sd->mutex);
+		RID last_font;
+		int last_size = 0;
+		for (const Glyph &gl : sd->glyphs) {
+			if (!gl.font_rid.is_valid() || (gl.font_rid == last_font && gl.font_size == last_size)) {
+				continue;
+			}
+			last_font = gl.font_rid;
+			last_size = gl.font_size;
+			const FontAdvanced *fd = _get_font_data(gl.font_rid);
+			if (fd) {
+				shaped_sizes[fd].insert(_get_size(fd, gl.font_size).x);
+			}
+		}
+	}
+
+	struct EvictionCandidate {
+		RID font_rid;
+		Vector2i size;
+		uint64_t last_used = 0;
+
+		bool operator<(const EvictionCandidate &p_other) const { return last_used < p_other.last_used; }
+	};
+
+	int64_t memory = 0;
+	Vector<EvictionCandidate> candidates;
+
+	List<RID> fonts;
+	font_owner.get_owned_list(&fonts);
+	for (const RID &E : fonts) {
+		FontAdvanced *fd = font_owner.get_or_null(E);
+		const HashSet<int32_t> *sizes = shaped_sizes.getptr(fd);
+		MutexLock lock(fd->mutex);
+		for (const KeyValue<Vector2i, FontForSizeAdvanced *> &F : fd->cache) {
+			if (sizes && sizes->has(F.key.x)) {
+				F.value->last_used = epoch;
+			}
+			int64_t size_memory = F.value->get_texture_memory();
+			memory += size_memory;
+#ifdef MODULE_FREETYPE_ENABLED
+			// Only glyphs that can be rasterized again are evicted, i.e. not the ones of pre-rendered fonts.
+			// Recently used glyphs are kept, for longer each time they are evicted and used again.
+			const uint64_t keep = GLYPH_CACHE_KEEP_TRIMS << MIN(F.value->evictions, 6u);
+			if (size_memory > 0 && F.value->face && F.value->last_used + keep <= epoch) {
+				EvictionCandidate candidate;
+				candidate.font_rid = E;
+				candidate.size = F.key;
+				candidate.last_used = F.value->last_used;
+				candidates.push_back(candidate);
+			}
+#endif
+		}
+	}
+
+	TypedArray<RID> canvas_items;
+	if (memory <= p_max_memory) {
+		return canvas_items;
+	}
+
+	// Evict whole size caches, least recently used first, down to a margin below the budget so that
+	// the next trims don't evict again right away. Glyphs are packed in shelves that can't release
+	// single glyphs, so the glyphs still in use are packed again into new textures.
+	const int64_t target_memory = p_max_memory - p_max_memory / 4;
+	HashSet<RID> redraw;
+	bool redraw_all = false;
+	candidates.sort();
+	int64_t evicted = 0;
+	for (const EvictionCandidate &candidate : candidates) {
+		if (memory <= target_memory) {
+			break;
+		}
+
+		FontAdvanced *fd = font_owner.get_or_null(candidate.font_rid);
+		MutexLock lock(fd->mutex);
+		HashMap<Vector2i, FontForSizeAdvanced *, VariantHasher, VariantComparator>::Iterator F = fd->cache.find(candidate.size);
+		if (!F || F->value->last_used != candidate.last_used) {
+			continue;
+		}
+
+		memory -= F->value->get_texture_memory();
+		F->value->textures.clear();
+		F->value->glyph_map.clear();
+		F->value->evictions++;
+		redraw_all = redraw_all || F->value->drawn_by_many_canvas_items;
+		for (const RID &ci : F->value->canvas_items) {
+			redraw.insert(ci);
+		}
+		F->value->canvas_items.clear();
+		F->value->last_canvas_item = RID();
+		F->value->drawn_by_many_canvas_items = false;
+		evicted++;
+	}
+
+	glyph_cache_evictions.add(evicted);
+
+	if (redraw_all) {
+		canvas_items.push_back(RID());
+	} else {
+		for (const RID &ci : redraw) {
+			canvas_items.push_back(ci);
+		}
+	}
+	return canvas_items;
+}
+
 /*************************************************************************/
 /* Shaped text buffer interface                                          */
 /*************************************************************************/
@@ -5838,6 +6142,16 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 
 	// Process glyphs.
 	if (glyph_count > 0) {
+		if (glyph_count >= (unsigned int)glyph_batch_size * 2) {
+			// Long runs are likely to use many new glyphs, rasterize them in parallel.
+			Vector<int32_t> glyphs;
+			glyphs.resize(glyph_count);
+			for (unsigned int i = 0; i < glyph_count; i++) {
+				glyphs.write[i] = (int32_t)glyph_info[i].codepoint | mod;
+			}
+			_ensure_glyphs(fd, fss, glyphs);
+		}
+
 		Glyph *w = (Glyph *)memalloc(glyph_count * sizeof(Glyph));
 
 		int end = (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) ? p_end : 0;
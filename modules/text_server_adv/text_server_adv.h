@@ -75,6 +75,7 @@
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
+#include <godot_cpp/templates/safe_refcount.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
 using namespace godot;
@@ -85,7 +86,9 @@ using namespace godot;
 #include "core/extension/ext_wrappers.gen.inc"
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
 
@@ -128,6 +131,8 @@ using namespace godot;
 #include <hb-icu.h>
 #include <hb.h>
 
+#include <atomic>
+
 /*************************************************************************/
 
 class TextServerAdvanced : public TextServerExtension {
@@ -171,6 +176,7 @@ class TextServerAdvanced : public TextServerExtension {
 #endif
 
 	const int rect_range = 1;
+	const int glyph_batch_size = 64; // Minimum amount of new glyphs rasterized by each worker thread, see _ensure_glyphs().
 
 	struct FontTexturePosition {
 		int32_t index = -1;
@@ -262,6 +268,22 @@ class TextServerAdvanced : public TextServerExtension {
 		Vector2 advance;
 	};
 
+	// Glyph rasterized outside of the texture atlas, see _ensure_glyphs().
+	struct GlyphImage {
+		bool rasterized = false;
+		bool found = false;
+		bool has_image = false;
+		bool msdf = false;
+		int width = 0;
+		int height = 0;
+		int color_size = 2;
+		Image::Format format = Image::FORMAT_LA8;
+		PackedByteArray data;
+		Vector2 offset;
+		double scale = 1.0;
+		Vector2 advance;
+	};
+
 	struct FontForSizeAdvanced {
 		double ascent = 0.0;
 		double descent = 0.0;
@@ -271,6 +293,26 @@ class TextServerAdvanced : public TextServerExtension {
 		double oversampling = 1.0;
 
 		Vector2i size;
+		// Glyph cache epoch of the last use, and number of times the glyphs were evicted, see font_trim_global_glyph_cache().
+		uint64_t last_used = 0;
+		uint32_t evictions = 0;
+
+		// Canvas items that drew glyphs since they were rasterized, redrawn if they are evicted.
+		HashSet<RID> canvas_items;
+		RID last_canvas_item;
+		bool drawn_by_many_canvas_items = false;
+
+		void add_canvas_item(const RID &p_canvas_item) {
+			if (p_canvas_item == last_canvas_item || drawn_by_many_canvas_items) {
+				return;
+			}
+			last_canvas_item = p_canvas_item;
+			canvas_items.insert(p_canvas_item);
+			if (canvas_items.size() > 1024) {
+				drawn_by_many_canvas_items = true;
+				canvas_items.clear();
+			}
+		}
 
 		Vector<ShelfPackTexture> textures;
 		HashMap<int64_t, int64_t> inv_glyph_map;
@@ -283,6 +325,14 @@ class TextServerAdvanced : public TextServerExtension {
 		FT_StreamRec stream;
 #endif
 
+		int64_t get_texture_memory() const {
+			int64_t memory = 0;
+			for (const ShelfPackTexture &tex : textures) {
+				memory += tex.imgdata.size();
+			}
+			return memory;
+		}
+
 		~FontForSizeAdvanced() {
 			if (hb_handle != nullptr) {
 				hb_font_destroy(hb_handle);
@@ -351,17 +401,41 @@ class TextServerAdvanced : public TextServerExtension {
 		}
 	};
 
+#ifdef MODULE_FREETYPE_ENABLED
+	struct GlyphBatch {
+		const TextServerAdvanced *server = nullptr;
+		FontAdvanced *font_data = nullptr;
+		FontForSizeAdvanced *size_data = nullptr;
+		Vector2i size;
+		FT_Long face_index = 0;
+		int strike_index = -1;
+		Vector<FT_Fixed> var_coords;
+
+		const int32_t *glyphs = nullptr;
+		GlyphImage *images = nullptr;
+		int count = 0;
+		int batch_size = 0;
+	};
+#endif
+
 	_FORCE_INLINE_ FontTexturePosition find_texture_pos_for_glyph(FontForSizeAdvanced *p_data, int p_color_size, Image::Format p_image_format, int p_width, int p_height, bool p_msdf) const;
 #ifdef MODULE_MSDFGEN_ENABLED
-	_FORCE_INLINE_ FontGlyph rasterize_msdf(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance) const;
+	_FORCE_INLINE_ void rasterize_msdf(int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance, bool p_threaded, GlyphImage &r_image) const;
 #endif
 #ifdef MODULE_FREETYPE_ENABLED
-	_FORCE_INLINE_ FontGlyph rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap bitmap, int yofs, int xofs, const Vector2 &advance, bool p_bgra) const;
+	_FORCE_INLINE_ void rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap bitmap, int yofs, int xofs, const Vector2 &advance, bool p_bgra, GlyphImage &r_image) const;
+	void _rasterize_glyph(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, FT_Face p_face, const Vector2i &p_size, int32_t p_glyph, bool p_threaded_msdf, GlyphImage &r_image) const;
 #endif
+	FontGlyph _insert_glyph_image(FontForSizeAdvanced *p_data, int p_rect_margin, const GlyphImage &p_image) const;
 	_FORCE_INLINE_ bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
+	void _ensure_glyphs(FontAdvanced *p_font_data, const Vector2i &p_size, const Vector<int32_t> &p_glyphs) const;
+	void _get_glyph_variants(const FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index, Vector<int32_t> &r_glyphs) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const;
 	_FORCE_INLINE_ void _font_clear_cache(FontAdvanced *p_font_data);
 	static void _generateMTSDF_threaded(void *p_td, uint32_t p_y);
+#ifdef MODULE_FREETYPE_ENABLED
+	static void _rasterize_glyphs_threaded(void *p_td, uint32_t p_batch);
+#endif
 
 	_FORCE_INLINE_ Vector2i _get_size(const FontAdvanced *p_font_data, int p_size) const {
 		if (p_font_data->msdf) {
@@ -542,6 +616,9 @@ class TextServerAdvanced : public TextServerExtension {
 	// Common data.
 
 	double oversampling = 1.0;
+	static const uint64_t GLYPH_CACHE_KEEP_TRIMS = 3; // Size caches used in the last trims aren't evicted.
+	std::atomic<uint64_t> glyph_cache_epoch = 1;
+	SafeNumeric<int64_t> glyph_cache_evictions;
 	mutable RID_PtrOwner<FontAdvancedLinkedVariation> font_var_owner;
 	mutable RID_PtrOwner<FontAdvanced> font_owner;
 	mutable RID_PtrOwner<ShapedTextDataAdvanced> shaped_owner;
@@ -885,6 +962,10 @@ public:
 	MODBIND0RC(double, font_get_global_oversampling);
 	MODBIND1(font_set_global_oversampling, double);
 
+	MODBIND0RC(int64_t, font_get_global_glyph_cache_memory);
+	MODBIND0RC(int64_t, font_get_global_glyph_cache_eviction_count);
+	MODBIND1R(TypedArray<RID>, font_trim_global_glyph_cache, int64_t);
+
 	/* Shaped text buffer interface */
 
 	MODBIND2R(RID, create_shaped_text, Direction, Orientation);
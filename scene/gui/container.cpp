@@ -32,6 +32,7 @@
 #include "container.h"
 
 #include "core/object/message_queue.h"
+#include "scene/main/viewport.h"
 
 void Container::_child_minsize_changed() {
 	update_minimum_size();
@@ -139,7 +140,12 @@ void Container::queue_sort() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+	if (is_current_thread_safe_for_nodes()) {
+		get_viewport()->gui_queue_sort(this);
+	} else {
+		// The viewport's layout pass can only be queued from the main thread, sort on our own instead.
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+	}
 	pending_sort = true;
 }
 
@@ -37,6 +37,8 @@
 class Container : public Control {
 	GDCLASS(Container, Control);
 
+	friend class Viewport;
+
 	bool pending_sort = false;
 	void _sort_children();
 	void _child_minsize_changed();
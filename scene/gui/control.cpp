@@ -1623,7 +1623,12 @@ void Control::update_minimum_size() {
 	}
 	data.updating_last_minimum_size = true;
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Control::_update_minimum_size));
+	if (is_current_thread_safe_for_nodes()) {
+		get_viewport()->gui_queue_minimum_size_update(this);
+	} else {
+		// The viewport's layout pass can only be queued from the main thread, update on our own instead.
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Control::_update_minimum_size));
+	}
 }
 
 void Control::set_block_minimum_size_adjust(bool p_block) {
@@ -39,6 +39,9 @@
 void ItemList::_shape_text(int p_idx) {
 	Item &item = items.write[p_idx];
 
+	if (item.text_buf.is_null()) {
+		item.text_buf.instantiate();
+	}
 	item.text_buf->clear();
 	if (item.text_direction == Control::TEXT_DIRECTION_INHERITED) {
 		item.text_buf->set_direction(is_layout_rtl() ? TextServer::DIRECTION_RTL : TextServer::DIRECTION_LTR);
@@ -53,6 +56,36 @@ void ItemList::_shape_text(int p_idx) {
 	}
 	item.text_buf->set_text_overrun_behavior(text_overrun_behavior);
 	item.text_buf->set_max_lines_visible(max_text_lines);
+	if (fixed_column_width > 0) {
+		item.text_buf->set_width(fixed_column_width);
+	}
+	item.text_dirty = false;
+}
+
+bool ItemList::_is_text_size_uniform() const {
+	return uniform_text_size && fixed_column_width > 0;
+}
+
+bool ItemList::_is_icon_pending(int p_idx) const {
+	// Space is kept for icons that are still being provided, so the layout doesn't jump when they arrive.
+	return items[p_idx].icon.is_null() && icon_provider.is_valid() && fixed_icon_size.x > 0 && fixed_icon_size.y > 0;
+}
+
+void ItemList::_request_icon(int p_idx, uint32_t p_id) {
+	// Items may have been removed, moved or sorted since the request was queued.
+	if (p_idx >= items.size() || items[p_idx].id != p_id) {
+		p_idx = -1;
+		for (int i = 0; i < items.size(); i++) {
+			if (items[i].id == p_id) {
+				p_idx = i;
+				break;
+			}
+		}
+	}
+
+	if (p_idx != -1 && items[p_idx].icon.is_null() && icon_provider.is_valid()) {
+		icon_provider.call(p_idx);
+	}
 }
 
 int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bool p_selectable) {
@@ -63,8 +96,6 @@ int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bo
 	items.push_back(item);
 	int item_id = items.size() - 1;
 
-	_shape_text(items.size() - 1);
-
 	queue_redraw();
 	shape_changed = true;
 	notify_property_list_changed();
@@ -95,7 +126,7 @@ void ItemList::set_item_text(int p_idx, const String &p_text) {
 	}
 
 	items.write[p_idx].text = p_text;
-	_shape_text(p_idx);
+	items.write[p_idx].text_dirty = true;
 	queue_redraw();
 	shape_changed = true;
 }
@@ -113,7 +144,8 @@ void ItemList::set_item_text_direction(int p_idx, Control::TextDirection p_text_
 	ERR_FAIL_COND((int)p_text_direction < -1 || (int)p_text_direction > 3);
 	if (items[p_idx].text_direction != p_text_direction) {
 		items.write[p_idx].text_direction = p_text_direction;
-		_shape_text(p_idx);
+		items.write[p_idx].text_dirty = true;
+		shape_changed = true;
 		queue_redraw();
 	}
 }
@@ -130,7 +162,8 @@ void ItemList::set_item_language(int p_idx, const String &p_language) {
 	ERR_FAIL_INDEX(p_idx, items.size());
 	if (items[p_idx].language != p_language) {
 		items.write[p_idx].language = p_language;
-		_shape_text(p_idx);
+		items.write[p_idx].text_dirty = true;
+		shape_changed = true;
 		queue_redraw();
 	}
 }
@@ -534,11 +567,41 @@ bool ItemList::is_same_column_width() const {
 	return same_column_width;
 }
 
+void ItemList::set_uniform_text_size(bool p_enable) {
+	if (uniform_text_size == p_enable) {
+		return;
+	}
+
+	uniform_text_size = p_enable;
+	queue_redraw();
+	shape_changed = true;
+}
+
+bool ItemList::is_uniform_text_size() const {
+	return uniform_text_size;
+}
+
+void ItemList::set_icon_provider(const Callable &p_provider) {
+	icon_provider = p_provider;
+	for (int i = 0; i < items.size(); i++) {
+		items.write[i].icon_requested = false;
+	}
+	queue_redraw();
+	shape_changed = true;
+}
+
+Callable ItemList::get_icon_provider() const {
+	return icon_provider;
+}
+
 void ItemList::set_max_text_lines(int p_lines) {
 	ERR_FAIL_COND(p_lines < 1);
 	if (max_text_lines != p_lines) {
 		max_text_lines = p_lines;
 		for (int i = 0; i < items.size(); i++) {
+			if (items[i].text_buf.is_null()) {
+				continue;
+			}
 			if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
 				items.write[i].text_buf->set_break_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND | TextServer::BREAK_TRIM_EDGE_SPACES);
 				items.write[i].text_buf->set_max_lines_visible(p_lines);
@@ -589,6 +652,9 @@ void ItemList::set_icon_mode(IconMode p_mode) {
 	if (icon_mode != p_mode) {
 		icon_mode = p_mode;
 		for (int i = 0; i < items.size(); i++) {
+			if (items[i].text_buf.is_null()) {
+				continue;
+			}
 			if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
 				items.write[i].text_buf->set_break_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND | TextServer::BREAK_TRIM_EDGE_SPACES);
 			} else {
@@ -1005,7 +1071,7 @@ void ItemList::_notification(int p_what) {
 		case NOTIFICATION_TRANSLATION_CHANGED:
 		case NOTIFICATION_THEME_CHANGED: {
 			for (int i = 0; i < items.size(); i++) {
-				_shape_text(i);
+				items.write[i].text_dirty = true;
 			}
 			shape_changed = true;
 			queue_redraw();
@@ -1162,6 +1228,16 @@ void ItemList::_notification(int p_what) {
 					}
 				}
 
+				if (items[i].icon.is_null() && !items[i].icon_requested && icon_provider.is_valid()) {
+					// Deferred, so the provider can set the icon right away without redrawing while drawing.
+					Item &item = items.write[i];
+					item.icon_requested = true;
+					if (item.id == 0) {
+						item.id = ++last_item_id;
+					}
+					callable_mp(this, &ItemList::_request_icon).call_deferred(i, item.id);
+				}
+
 				Vector2 text_ofs;
 				if (items[i].icon.is_valid()) {
 					Size2 icon_size;
@@ -1225,6 +1301,10 @@ void ItemList::_notification(int p_what) {
 				if (!items[i].text.is_empty()) {
 					int max_len = -1;
 
+					if (items[i].text_dirty) {
+						_shape_text(i);
+					}
+
 					Vector2 size2 = items[i].text_buf->get_size();
 					if (fixed_column_width) {
 						max_len = fixed_column_width;
@@ -1326,10 +1406,14 @@ void ItemList::force_update_list_size() {
 	Size2 size = get_size();
 	float max_column_width = 0.0;
 
+	// With uniform text size, the layout is computed without shaping, and only drawn items are shaped.
+	const bool text_size_uniform = _is_text_size_uniform();
+	const int text_lines = (icon_mode == ICON_MODE_TOP && max_text_lines > 0) ? max_text_lines : 1;
+
 	//1- compute item minimum sizes
 	for (int i = 0; i < items.size(); i++) {
 		Size2 minsize;
-		if (items[i].icon.is_valid()) {
+		if (items[i].icon.is_valid() || _is_icon_pending(i)) {
 			if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
 				minsize = fixed_icon_size * icon_scale;
 			} else {
@@ -1352,8 +1436,16 @@ void ItemList::force_update_list_size() {
 			} else if (same_column_width) {
 				max_width = items[i].rect_cache.size.x;
 			}
-			items.write[i].text_buf->set_width(max_width);
-			Size2 s = items[i].text_buf->get_size();
+			Size2 s;
+			if (text_size_uniform) {
+				s = Size2(fixed_column_width, theme_cache.font->get_height(theme_cache.font_size) * text_lines);
+			} else {
+				if (items[i].text_dirty) {
+					_shape_text(i);
+				}
+				items.write[i].text_buf->set_width(max_width);
+				s = items[i].text_buf->get_size();
+			}
 
 			if (icon_mode == ICON_MODE_TOP) {
 				minsize.x = MAX(minsize.x, s.width);
@@ -1658,7 +1750,9 @@ void ItemList::set_text_overrun_behavior(TextServer::OverrunBehavior p_behavior)
 	if (text_overrun_behavior != p_behavior) {
 		text_overrun_behavior = p_behavior;
 		for (int i = 0; i < items.size(); i++) {
-			items.write[i].text_buf->set_text_overrun_behavior(p_behavior);
+			if (items[i].text_buf.is_valid()) {
+				items.write[i].text_buf->set_text_overrun_behavior(p_behavior);
+			}
 		}
 		shape_changed = true;
 		queue_redraw();
@@ -1799,6 +1893,12 @@ void ItemList::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_same_column_width", "enable"), &ItemList::set_same_column_width);
 	ClassDB::bind_method(D_METHOD("is_same_column_width"), &ItemList::is_same_column_width);
 
+	ClassDB::bind_method(D_METHOD("set_uniform_text_size", "enable"), &ItemList::set_uniform_text_size);
+	ClassDB::bind_method(D_METHOD("is_uniform_text_size"), &ItemList::is_uniform_text_size);
+
+	ClassDB::bind_method(D_METHOD("set_icon_provider", "provider"), &ItemList::set_icon_provider);
+	ClassDB::bind_method(D_METHOD("get_icon_provider"), &ItemList::get_icon_provider);
+
 	ClassDB::bind_method(D_METHOD("set_max_text_lines", "lines"), &ItemList::set_max_text_lines);
 	ClassDB::bind_method(D_METHOD("get_max_text_lines"), &ItemList::get_max_text_lines);
 
@@ -1854,6 +1954,7 @@ void ItemList::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_columns", PROPERTY_HINT_RANGE, "0,10,1,or_greater"), "set_max_columns", "get_max_columns");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "same_column_width"), "set_same_column_width", "is_same_column_width");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "fixed_column_width", PROPERTY_HINT_RANGE, "0,100,1,or_greater,suffix:px"), "set_fixed_column_width", "get_fixed_column_width");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "uniform_text_size"), "set_uniform_text_size", "is_uniform_text_size");
 	ADD_GROUP("Icon", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "icon_mode", PROPERTY_HINT_ENUM, "Top,Left"), "set_icon_mode", "get_icon_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "icon_scale"), "set_icon_scale", "get_icon_scale");
@@ -58,9 +58,12 @@ private:
 		Color icon_modulate = Color(1, 1, 1, 1);
 		Ref<Texture2D> tag_icon;
 		String text;
-		Ref<TextParagraph> text_buf;
+		Ref<TextParagraph> text_buf; // Null until the text is first shaped.
+		bool text_dirty = true; // Shaped before layout, or once drawn when text size is uniform.
 		String language;
 		TextDirection text_direction = TEXT_DIRECTION_AUTO;
+		bool icon_requested = false;
+		uint32_t id = 0; // Assigned when the icon is requested, to find the item again once the request runs.
 
 		bool selectable = true;
 		bool selected = false;
@@ -78,10 +81,6 @@ private:
 		Size2 get_icon_size() const;
 
 		bool operator<(const Item &p_another) const { return text < p_another.text; }
-
-		Item() {
-			text_buf.instantiate();
-		}
 	};
 
 	int current = -1;
@@ -96,6 +95,10 @@ private:
 	bool auto_height = false;
 	float auto_height_value = 0.0;
 
+	bool uniform_text_size = false;
+	Callable icon_provider;
+	uint32_t last_item_id = 0;
+
 	Vector<Item> items;
 	Vector<int> separators;
 
@@ -150,6 +153,9 @@ private:
 
 	void _scroll_changed(double);
 	void _shape_text(int p_idx);
+	bool _is_text_size_uniform() const;
+	bool _is_icon_pending(int p_idx) const;
+	void _request_icon(int p_idx, uint32_t p_id);
 	void _mouse_exited();
 
 protected:
@@ -238,6 +244,12 @@ public:
 	void set_same_column_width(bool p_enable);
 	bool is_same_column_width() const;
 
+	void set_uniform_text_size(bool p_enable);
+	bool is_uniform_text_size() const;
+
+	void set_icon_provider(const Callable &p_provider);
+	Callable get_icon_provider() const;
+
 	void set_max_text_lines(int p_lines);
 	int get_max_text_lines() const;
 
@@ -3359,6 +3359,18 @@ bool RichTextLabel::remove_paragraph(const int p_paragraph) {
 		return false;
 	}
 
+	// When a laid out paragraph of the main frame is removed (e.g. when trimming the start of a log),
+	// the following paragraphs are only moved up, instead of being shaped again.
+	int laid_out_lines = MIN(main->first_invalid_line.load(), MIN(main->first_resized_line.load(), main->first_invalid_font_line.load()));
+	bool keep_layout = current_frame == main && p_paragraph < laid_out_lines;
+	float removed_height = 0.0;
+	int removed_chars = 0;
+	if (keep_layout) {
+		const Line &l = main->lines[p_paragraph];
+		removed_height = _calculate_line_vertical_offset(l) - l.offset.y;
+		removed_chars = l.char_count;
+	}
+
 	// Remove all subitems with the same line as that provided.
 	Vector<List<Item *>::Element *> subitem_to_remove;
 	if (current_frame->lines[p_paragraph].from) {
@@ -3394,9 +3406,20 @@ bool RichTextLabel::remove_paragraph(const int p_paragraph) {
 		main->lines[0].from = main;
 	}
 
-	main->first_invalid_line.store(MIN(main->first_invalid_line.load(), p_paragraph));
-	main->first_resized_line.store(MIN(main->first_resized_line.load(), p_paragraph));
-	main->first_invalid_font_line.store(MIN(main->first_invalid_font_line.load(), p_paragraph));
+	if (keep_layout) {
+		for (int i = p_paragraph; i < laid_out_lines - 1; i++) {
+			main->lines[i].offset.y -= removed_height;
+			main->lines[i].char_offset -= removed_chars;
+		}
+		main->first_invalid_line.store(main->first_invalid_line.load() - 1);
+		main->first_invalid_font_line.store(main->first_invalid_font_line.load() - 1);
+		// Resize the last line, to update the scroll bar to the new content height.
+		main->first_resized_line.store(MIN(main->first_resized_line.load() - 1, (int)main->lines.size() - 1));
+	} else {
+		main->first_invalid_line.store(MIN(main->first_invalid_line.load(), p_paragraph));
+		main->first_resized_line.store(MIN(main->first_resized_line.load(), p_paragraph));
+		main->first_invalid_font_line.store(MIN(main->first_invalid_font_line.load(), p_paragraph));
+	}
 	queue_redraw();
 
 	return true;
@@ -54,6 +54,7 @@ void TextEdit::Text::set_font(const Ref<Font> &p_font) {
 	}
 	font = p_font;
 	is_dirty = true;
+	_clear_char_advances();
 }
 
 void TextEdit::Text::set_font_size(int p_font_size) {
@@ -62,6 +63,7 @@ void TextEdit::Text::set_font_size(int p_font_size) {
 	}
 	font_size = p_font_size;
 	is_dirty = true;
+	_clear_char_advances();
 }
 
 void TextEdit::Text::set_tab_size(int p_tab_size) {
@@ -96,9 +98,9 @@ void TextEdit::Text::set_draw_control_chars(bool p_enabled) {
 int TextEdit::Text::get_line_width(int p_line, int p_wrap_index) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
 	if (p_wrap_index != -1) {
-		return text[p_line].data_buf->get_line_width(p_wrap_index);
+		return _get_line_buffer(p_line)->get_line_width(p_wrap_index);
 	}
-	return text[p_line].data_buf->get_size().x;
+	return _get_line_buffer(p_line)->get_size().x;
 }
 
 int TextEdit::Text::get_line_height() const {
@@ -124,29 +126,34 @@ BitField<TextServer::LineBreakFlag> TextEdit::Text::get_brk_flags() const {
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
 
-	return text[p_line].data_buf->get_line_count() - 1;
+	// Wrap amounts outlive evicted buffers, so only unknown ones need shaping.
+	if (text[p_line].wrap_amount < 0) {
+		_get_line_buffer(p_line);
+	}
+	return text[p_line].wrap_amount;
 }
 
 Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 	Vector<Vector2i> ret;
 	ERR_FAIL_INDEX_V(p_line, text.size(), ret);
 
-	for (int i = 0; i < text[p_line].data_buf->get_line_count(); i++) {
-		ret.push_back(text[p_line].data_buf->get_line_range(i));
+	const Ref<TextParagraph> &data_buf = _get_line_buffer(p_line);
+	for (int i = 0; i < data_buf->get_line_count(); i++) {
+		ret.push_back(data_buf->get_line_range(i));
 	}
 	return ret;
 }
 
 const Ref<TextParagraph> TextEdit::Text::get_line_data(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), Ref<TextParagraph>());
-	return text[p_line].data_buf;
+	return _get_line_buffer(p_line);
 }
 
 _FORCE_INLINE_ const String &TextEdit::Text::operator[](int p_line) const {
 	return text[p_line].data;
 }
 
-void TextEdit::Text::_calculate_line_height() {
+void TextEdit::Text::_calculate_line_height() const {
 	int height = 0;
 	for (const Line &l : text) {
 		// Found another line with the same height...nothing to update.
@@ -159,7 +166,7 @@ void TextEdit::Text::_calculate_line_height() {
 	line_height = height;
 }
 
-void TextEdit::Text::_calculate_max_line_width() {
+void TextEdit::Text::_calculate_max_line_width() const {
 	int line_width = 0;
 	for (const Line &l : text) {
 		if (l.hidden) {
@@ -176,6 +183,157 @@ void TextEdit::Text::_calculate_max_line_width() {
 	max_width = line_width;
 }
 
+void TextEdit::Text::_set_line_size(int p_line, int p_width, int p_height) const {
+	// Update height.
+	const int old_height = text[p_line].height;
+	text[p_line].height = p_height;
+
+	// If this line has shrunk, this may no longer the the tallest line.
+	if (old_height == line_height && p_height < line_height) {
+		_calculate_line_height();
+	} else {
+		line_height = MAX(p_height, line_height);
+	}
+
+	// Update width.
+	const int old_width = text[p_line].width;
+	text[p_line].width = p_width;
+
+	// If this line has shrunk, this may no longer the the longest line.
+	if (old_width == max_width && p_width < max_width) {
+		_calculate_max_line_width();
+	} else if (!is_hidden(p_line)) {
+		max_width = MAX(p_width, max_width);
+	}
+}
+
+void TextEdit::Text::_update_line_size(int p_line) const {
+	const Ref<TextParagraph> &data_buf = text[p_line].data_buf;
+	const int wrap_amount = data_buf->get_line_count() - 1;
+	int height = font_height;
+	for (int i = 0; i <= wrap_amount; i++) {
+		height = MAX(height, data_buf->get_line_size(i).y);
+	}
+	text[p_line].wrap_amount = wrap_amount;
+	_set_line_size(p_line, data_buf->get_size().x, height);
+}
+
+void TextEdit::Text::_clear_char_advances() {
+	for (int i = 0; i < 128; i++) {
+		ascii_advances[i] = -1.0;
+	}
+	char_advances.clear();
+}
+
+float TextEdit::Text::_get_char_advance(char32_t p_char) {
+	if (p_char < 128) {
+		if (ascii_advances[p_char] < 0.0) {
+			ascii_advances[p_char] = font->get_char_size(p_char, font_size).width;
+		}
+		return ascii_advances[p_char];
+	}
+
+	const float *advance = char_advances.getptr(p_char);
+	if (advance) {
+		return *advance;
+	}
+	const float char_advance = font->get_char_size(p_char, font_size).width;
+	char_advances.insert(p_char, char_advance);
+	return char_advance;
+}
+
+int TextEdit::Text::_estimate_line_width(int p_line) {
+	const String &str = text[p_line].data;
+	const char32_t *chars = str.get_data();
+	const float tab_width = tab_size > 0 ? _get_char_advance(' ') * tab_size : 0.0;
+
+	float line_width = 0.0;
+	for (int i = 0; i < str.length(); i++) {
+		if (chars[i] == '\t' && tab_width > 0.0) {
+			line_width = (Math::floor(line_width / tab_width) + 1.0) * tab_width;
+		} else {
+			line_width += _get_char_advance(chars[i]);
+		}
+	}
+	return Math::ceil(line_width);
+}
+
+void TextEdit::Text::_shape_line(int p_line) const {
+	Line &line = text[p_line];
+	if (line.data_buf.is_null()) {
+		line.data_buf.instantiate();
+		shaped_lines++;
+	}
+	line.ime = false;
+
+	line.data_buf->clear();
+	line.data_buf->set_width(width);
+	line.data_buf->set_direction((TextServer::Direction)direction);
+	line.data_buf->set_break_flags(brk_flags);
+	line.data_buf->set_preserve_control(draw_control_chars);
+	if (font.is_null()) {
+		line.wrap_amount = 0;
+		return; // Not in tree?
+	}
+
+	line.data_buf->add_string(line.data, font, font_size, language);
+	if (!line.bidi_override.is_empty()) {
+		TS->shaped_text_set_bidi_override(line.data_buf->get_rid(), line.bidi_override);
+	}
+
+	// Apply tab align.
+	if (tab_size > 0) {
+		Vector<float> tabs;
+		tabs.push_back(font->get_char_size(' ', font_size).width * tab_size);
+		line.data_buf->tab_align(tabs);
+	}
+
+	_update_line_size(p_line);
+}
+
+void TextEdit::Text::_evict_shaped_lines() const {
+	// Drop the buffers of the least recently used lines, keeping some headroom so this runs rarely.
+	LocalVector<uint64_t> used;
+	for (const Line &l : text) {
+		if (l.data_buf.is_valid() && !l.ime) {
+			used.push_back(l.last_used);
+		}
+	}
+
+	const int keep = max_shaped_lines * 3 / 4;
+	if ((int)used.size() > keep) {
+		const int evict = used.size() - keep;
+		SortArray<uint64_t> sorter;
+		sorter.nth_element(0, used.size(), evict, used.ptr());
+		const uint64_t oldest_kept = used[evict];
+
+		for (int i = 0; i < text.size(); i++) {
+			if (text[i].data_buf.is_valid() && !text[i].ime && text[i].last_used < oldest_kept) {
+				text[i].data_buf.unref();
+			}
+		}
+	}
+
+	shaped_lines = 0;
+	for (const Line &l : text) {
+		if (l.data_buf.is_valid()) {
+			shaped_lines++;
+		}
+	}
+}
+
+const Ref<TextParagraph> &TextEdit::Text::_get_line_buffer(int p_line) const {
+	if (text[p_line].data_buf.is_null()) {
+		_shape_line(p_line);
+	}
+	text[p_line].last_used = ++line_use_tick;
+
+	if (shaped_lines > max_shaped_lines) {
+		_evict_shaped_lines();
+	}
+	return text[p_line].data_buf;
+}
+
 void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_changed, const String &p_ime_text, const Array &p_bidi_override) {
 	ERR_FAIL_INDEX(p_line, text.size());
 
@@ -183,32 +341,54 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 		return; // Not in tree?
 	}
 
-	if (p_text_changed) {
-		text.write[p_line].data_buf->clear();
+	if (p_ime_text.is_empty() && (p_text_changed || text[p_line].data_buf.is_null())) {
+		// Defer shaping until the line is drawn or measured, and estimate its size meanwhile.
+		Line &line = text[p_line];
+		if (line.data_buf.is_valid()) {
+			line.data_buf.unref();
+			shaped_lines--;
+		}
+		line.ime = false;
+		line.wrap_amount = -1;
+		_set_line_size(p_line, _estimate_line_width(p_line), font_height);
+		return;
+	}
+
+	// Lines showing IME text are shaped right away, and not evicted until their text changes.
+	bool text_changed = p_text_changed;
+	if (text[p_line].data_buf.is_null()) {
+		text[p_line].data_buf.instantiate();
+		shaped_lines++;
+		text_changed = true;
+	}
+	text[p_line].ime = p_ime_text.length() > 0;
+
+	if (text_changed) {
+		text[p_line].data_buf->clear();
 	}
 
-	text.write[p_line].data_buf->set_width(width);
-	text.write[p_line].data_buf->set_direction((TextServer::Direction)direction);
-	text.write[p_line].data_buf->set_break_flags(brk_flags);
-	text.write[p_line].data_buf->set_preserve_control(draw_control_chars);
+	text[p_line].data_buf->set_width(width);
+	text[p_line].data_buf->set_direction((TextServer::Direction)direction);
+	text[p_line].data_buf->set_break_flags(brk_flags);
+	text[p_line].data_buf->set_preserve_control(draw_control_chars);
 	if (p_ime_text.length() > 0) {
-		if (p_text_changed) {
-			text.write[p_line].data_buf->add_string(p_ime_text, font, font_size, language);
+		if (text_changed) {
+			text[p_line].data_buf->add_string(p_ime_text, font, font_size, language);
 		}
 		if (!p_bidi_override.is_empty()) {
-			TS->shaped_text_set_bidi_override(text.write[p_line].data_buf->get_rid(), p_bidi_override);
+			TS->shaped_text_set_bidi_override(text[p_line].data_buf->get_rid(), p_bidi_override);
 		}
 	} else {
-		if (p_text_changed) {
-			text.write[p_line].data_buf->add_string(text[p_line].data, font, font_size, language);
+		if (text_changed) {
+			text[p_line].data_buf->add_string(text[p_line].data, font, font_size, language);
 		}
 		if (!text[p_line].bidi_override.is_empty()) {
-			TS->shaped_text_set_bidi_override(text.write[p_line].data_buf->get_rid(), text[p_line].bidi_override);
+			TS->shaped_text_set_bidi_override(text[p_line].data_buf->get_rid(), text[p_line].bidi_override);
 		}
 	}
 
-	if (!p_text_changed) {
-		RID r = text.write[p_line].data_buf->get_rid();
+	if (!text_changed) {
+		RID r = text[p_line].data_buf->get_rid();
 		int spans = TS->shaped_get_span_count(r);
 		for (int i = 0; i < spans; i++) {
 			TS->shaped_set_span_update_font(r, i, font->get_rids(), font_size, font->get_opentype_features());
@@ -219,50 +399,39 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 	if (tab_size > 0) {
 		Vector<float> tabs;
 		tabs.push_back(font->get_char_size(' ', font_size).width * tab_size);
-		text.write[p_line].data_buf->tab_align(tabs);
+		text[p_line].data_buf->tab_align(tabs);
 	}
 
-	// Update height.
-	const int old_height = text.write[p_line].height;
-	const int wrap_amount = get_line_wrap_amount(p_line);
-	int height = font_height;
-	for (int i = 0; i <= wrap_amount; i++) {
-		height = MAX(height, text[p_line].data_buf->get_line_size(i).y);
-	}
-	text.write[p_line].height = height;
+	_update_line_size(p_line);
+	text[p_line].last_used = ++line_use_tick;
 
-	// If this line has shrunk, this may no longer the the tallest line.
-	if (old_height == line_height && height < line_height) {
-		_calculate_line_height();
-	} else {
-		line_height = MAX(height, line_height);
-	}
-
-	// Update width.
-	const int old_width = text.write[p_line].width;
-	int line_width = get_line_width(p_line);
-	text.write[p_line].width = line_width;
-
-	// If this line has shrunk, this may no longer the the longest line.
-	if (old_width == max_width && line_width < max_width) {
-		_calculate_max_line_width();
-	} else if (!is_hidden(p_line)) {
-		max_width = MAX(line_width, max_width);
+	if (shaped_lines > max_shaped_lines) {
+		_evict_shaped_lines();
 	}
 }
 
 void TextEdit::Text::invalidate_all_lines() {
 	for (int i = 0; i < text.size(); i++) {
-		text.write[i].data_buf->set_width(width);
-		text.write[i].data_buf->set_break_flags(brk_flags);
+		if (text[i].data_buf.is_null()) {
+			// Unshaped lines only need their estimates refreshed.
+			if (tab_size_dirty && font.is_valid()) {
+				text[i].width = _estimate_line_width(i);
+			}
+			text[i].wrap_amount = -1;
+			continue;
+		}
+
+		text[i].data_buf->set_width(width);
+		text[i].data_buf->set_break_flags(brk_flags);
 		if (tab_size_dirty) {
 			if (tab_size > 0) {
 				Vector<float> tabs;
 				tabs.push_back(font->get_char_size(' ', font_size).width * tab_size);
-				text.write[i].data_buf->tab_align(tabs);
+				text[i].data_buf->tab_align(tabs);
 			}
 		}
-		text.write[i].width = get_line_width(i);
+		text[i].width = text[i].data_buf->get_size().x;
+		text[i].wrap_amount = text[i].data_buf->get_line_count() - 1;
 	}
 	tab_size_dirty = false;
 
@@ -307,6 +476,7 @@ void TextEdit::Text::invalidate_all() {
 
 void TextEdit::Text::clear() {
 	text.clear();
+	shaped_lines = 0;
 
 	max_width = -1;
 	line_height = -1;
@@ -325,23 +495,12 @@ int TextEdit::Text::get_max_width() const {
 void TextEdit::Text::set(int p_line, const String &p_text, const Array &p_bidi_override) {
 	ERR_FAIL_INDEX(p_line, text.size());
 
-	text.write[p_line].data = p_text;
-	text.write[p_line].bidi_override = p_bidi_override;
+	text[p_line].data = p_text;
+	text[p_line].bidi_override = p_bidi_override;
 	invalidate_cache(p_line, -1, true);
 }
 
 void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector<Array> &p_bidi_override) {
-	int new_line_count = p_text.size() - 1;
-	if (new_line_count > 0) {
-		text.resize(text.size() + new_line_count);
-		for (int i = (text.size() - 1); i > p_at; i--) {
-			if ((i - new_line_count) <= 0) {
-				break;
-			}
-			text.write[i] = text[i - new_line_count];
-		}
-	}
-
 	for (int i = 0; i < p_text.size(); i++) {
 		if (i == 0) {
 			set(p_at + i, p_text[i], p_bidi_override[i]);
@@ -351,7 +510,7 @@ void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector
 		line.gutters.resize(gutter_count);
 		line.data = p_text[i];
 		line.bidi_override = p_bidi_override[i];
-		text.write[p_at + i] = line;
+		text.insert(p_at + i, line);
 		invalidate_cache(p_at + i, -1, true);
 	}
 }
@@ -377,11 +536,12 @@ void TextEdit::Text::remove_range(int p_from_line, int p_to_line) {
 		}
 	}
 
-	int diff = (p_to_line - p_from_line);
-	for (int i = p_to_line; i < text.size() - 1; i++) {
-		text.write[(i - diff) + 1] = text[i + 1];
+	for (int i = p_from_line + 1; i <= p_to_line; i++) {
+		if (text[i].data_buf.is_valid()) {
+			shaped_lines--;
+		}
 	}
-	text.resize(text.size() - diff);
+	text.remove_range(p_from_line + 1, p_to_line + 1);
 
 	if (dirty_height) {
 		_calculate_line_height();
@@ -395,9 +555,9 @@ void TextEdit::Text::remove_range(int p_from_line, int p_to_line) {
 void TextEdit::Text::add_gutter(int p_at) {
 	for (int i = 0; i < text.size(); i++) {
 		if (p_at < 0 || p_at > gutter_count) {
-			text.write[i].gutters.push_back(Gutter());
+			text[i].gutters.push_back(Gutter());
 		} else {
-			text.write[i].gutters.insert(p_at, Gutter());
+			text[i].gutters.insert(p_at, Gutter());
 		}
 	}
 	gutter_count++;
@@ -405,15 +565,19 @@ void TextEdit::Text::add_gutter(int p_at) {
 
 void TextEdit::Text::remove_gutter(int p_gutter) {
 	for (int i = 0; i < text.size(); i++) {
-		text.write[i].gutters.remove_at(p_gutter);
+		text[i].gutters.remove_at(p_gutter);
 	}
 	gutter_count--;
 }
 
 void TextEdit::Text::move_gutters(int p_from_line, int p_to_line) {
-	text.write[p_to_line].gutters = text[p_from_line].gutters;
-	text.write[p_from_line].gutters.clear();
-	text.write[p_from_line].gutters.resize(gutter_count);
+	text[p_to_line].gutters = text[p_from_line].gutters;
+	text[p_from_line].gutters.clear();
+	text[p_from_line].gutters.resize(gutter_count);
+}
+
+TextEdit::Text::Text() {
+	_clear_char_advances();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
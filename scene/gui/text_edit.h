@@ -32,6 +32,7 @@
 #ifndef TEXT_EDIT_H
 #define TEXT_EDIT_H
 
+#include "core/templates/block_vector.h"
 #include "scene/gui/control.h"
 #include "scene/gui/popup_menu.h"
 #include "scene/gui/scroll_bar.h"
@@ -150,23 +151,22 @@ private:
 
 			String data;
 			Array bidi_override;
-			Ref<TextParagraph> data_buf;
+			Ref<TextParagraph> data_buf; // Null until the line is shaped, see Text::_get_line_buffer().
 
 			Color background_color = Color(0, 0, 0, 0);
 			bool hidden = false;
+			bool ime = false;
 			int height = 0;
 			int width = 0;
-
-			Line() {
-				data_buf.instantiate();
-			}
+			int wrap_amount = -1;
+			uint64_t last_used = 0;
 		};
 
 	private:
 		bool is_dirty = false;
 		bool tab_size_dirty = false;
 
-		mutable Vector<Line> text;
+		mutable BlockVector<Line> text;
 		Ref<Font> font;
 		int font_size = -1;
 		int font_height = 0;
@@ -176,15 +176,33 @@ private:
 		BitField<TextServer::LineBreakFlag> brk_flags = TextServer::BREAK_MANDATORY;
 		bool draw_control_chars = false;
 
-		int line_height = -1;
-		int max_width = -1;
+		mutable int line_height = -1;
+		mutable int max_width = -1;
 		int width = -1;
 
 		int tab_size = 4;
 		int gutter_count = 0;
 
-		void _calculate_line_height();
-		void _calculate_max_line_width();
+		// Lines are shaped when first drawn or measured, and only the most recently used ones keep their buffers.
+		int max_shaped_lines = 4096;
+		mutable int shaped_lines = 0;
+		mutable uint64_t line_use_tick = 0;
+
+		float ascii_advances[128];
+		HashMap<char32_t, float> char_advances;
+
+		void _calculate_line_height() const;
+		void _calculate_max_line_width() const;
+		void _set_line_size(int p_line, int p_width, int p_height) const;
+		void _update_line_size(int p_line) const;
+
+		void _clear_char_advances();
+		float _get_char_advance(char32_t p_char);
+		int _estimate_line_width(int p_line);
+
+		void _shape_line(int p_line) const;
+		void _evict_shaped_lines() const;
+		const Ref<TextParagraph> &_get_line_buffer(int p_line) const;
 
 	public:
 		void set_tab_size(int p_tab_size);
@@ -212,7 +230,7 @@ private:
 			if (text[p_line].hidden == p_hidden) {
 				return;
 			}
-			text.write[p_line].hidden = p_hidden;
+			text[p_line].hidden = p_hidden;
 			if (!p_hidden && text[p_line].width > max_width) {
 				max_width = text[p_line].width;
 			} else if (p_hidden && text[p_line].width == max_width) {
@@ -232,28 +250,30 @@ private:
 
 		_FORCE_INLINE_ const String &operator[](int p_line) const;
 
+		Text();
+
 		/* Gutters. */
 		void add_gutter(int p_at);
 		void remove_gutter(int p_gutter);
 		void move_gutters(int p_from_line, int p_to_line);
 
-		void set_line_gutter_metadata(int p_line, int p_gutter, const Variant &p_metadata) { text.write[p_line].gutters.write[p_gutter].metadata = p_metadata; }
+		void set_line_gutter_metadata(int p_line, int p_gutter, const Variant &p_metadata) { text[p_line].gutters.write[p_gutter].metadata = p_metadata; }
 		const Variant &get_line_gutter_metadata(int p_line, int p_gutter) const { return text[p_line].gutters[p_gutter].metadata; }
 
-		void set_line_gutter_text(int p_line, int p_gutter, const String &p_text) { text.write[p_line].gutters.write[p_gutter].text = p_text; }
+		void set_line_gutter_text(int p_line, int p_gutter, const String &p_text) { text[p_line].gutters.write[p_gutter].text = p_text; }
 		const String &get_line_gutter_text(int p_line, int p_gutter) const { return text[p_line].gutters[p_gutter].text; }
 
-		void set_line_gutter_icon(int p_line, int p_gutter, const Ref<Texture2D> &p_icon) { text.write[p_line].gutters.write[p_gutter].icon = p_icon; }
+		void set_line_gutter_icon(int p_line, int p_gutter, const Ref<Texture2D> &p_icon) { text[p_line].gutters.write[p_gutter].icon = p_icon; }
 		const Ref<Texture2D> &get_line_gutter_icon(int p_line, int p_gutter) const { return text[p_line].gutters[p_gutter].icon; }
 
-		void set_line_gutter_item_color(int p_line, int p_gutter, const Color &p_color) { text.write[p_line].gutters.write[p_gutter].color = p_color; }
+		void set_line_gutter_item_color(int p_line, int p_gutter, const Color &p_color) { text[p_line].gutters.write[p_gutter].color = p_color; }
 		const Color &get_line_gutter_item_color(int p_line, int p_gutter) const { return text[p_line].gutters[p_gutter].color; }
 
-		void set_line_gutter_clickable(int p_line, int p_gutter, bool p_clickable) { text.write[p_line].gutters.write[p_gutter].clickable = p_clickable; }
+		void set_line_gutter_clickable(int p_line, int p_gutter, bool p_clickable) { text[p_line].gutters.write[p_gutter].clickable = p_clickable; }
 		bool is_line_gutter_clickable(int p_line, int p_gutter) const { return text[p_line].gutters[p_gutter].clickable; }
 
 		/* Line style. */
-		void set_line_background_color(int p_line, const Color &p_color) { text.write[p_line].background_color = p_color; }
+		void set_line_background_color(int p_line, const Color &p_color) { text[p_line].background_color = p_color; }
 		const Color get_line_background_color(int p_line) const { return text[p_line].background_color; }
 	};
 
@@ -596,6 +596,10 @@ void TreeItem::set_collapsed(bool p_collapsed) {
 		return;
 	}
 	collapsed = p_collapsed;
+	if (!collapsed && populate_on_expand) {
+		populate_on_expand = false;
+		tree->_populate_item(this);
+	}
 	TreeItem *ci = tree->selected_item;
 	if (ci) {
 		while (ci && ci != this) {
@@ -631,11 +635,27 @@ void TreeItem::set_collapsed_recursive(bool p_collapsed) {
 
 	TreeItem *child = get_first_child();
 	while (child) {
-		child->set_collapsed_recursive(p_collapsed);
+		// Expanding every branch populated on demand would create the whole data set, those are left collapsed.
+		if (p_collapsed || !child->populate_on_expand) {
+			child->set_collapsed_recursive(p_collapsed);
+		}
 		child = child->get_next();
 	}
 }
 
+void TreeItem::set_populate_on_expand(bool p_enable) {
+	populate_on_expand = p_enable;
+	if (populate_on_expand) {
+		// Nothing to show until expanded.
+		collapsed = true;
+		_changed_notify();
+	}
+}
+
+bool TreeItem::is_populate_on_expand() const {
+	return populate_on_expand;
+}
+
 bool TreeItem::_is_any_collapsed(bool p_only_visible) {
 	TreeItem *child = get_first_child();
 
@@ -1599,6 +1619,9 @@ void TreeItem::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_collapsed_recursive", "enable"), &TreeItem::set_collapsed_recursive);
 	ClassDB::bind_method(D_METHOD("is_any_collapsed", "only_visible"), &TreeItem::is_any_collapsed, DEFVAL(false));
 
+	ClassDB::bind_method(D_METHOD("set_populate_on_expand", "enable"), &TreeItem::set_populate_on_expand);
+	ClassDB::bind_method(D_METHOD("is_populate_on_expand"), &TreeItem::is_populate_on_expand);
+
 	ClassDB::bind_method(D_METHOD("set_visible", "enable"), &TreeItem::set_visible);
 	ClassDB::bind_method(D_METHOD("is_visible"), &TreeItem::is_visible);
 
@@ -1694,6 +1717,7 @@ void TreeItem::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collapsed"), "set_collapsed", "is_collapsed");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "visible"), "set_visible", "is_visible");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "disable_folding"), "set_disable_folding", "is_folding_disabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "populate_on_expand"), "set_populate_on_expand", "is_populate_on_expand");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "custom_minimum_height", PROPERTY_HINT_RANGE, "0,1000,1"), "set_custom_minimum_height", "get_custom_minimum_height");
 
 	BIND_ENUM_CONSTANT(CELL_MODE_STRING);
@@ -2390,7 +2414,7 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 			}
 		}
 
-		if (!p_item->disable_folding && !hide_folding && p_item->first_child && p_item->get_visible_child_count() != 0) { //has visible children, draw the guide box
+		if (!p_item->disable_folding && !hide_folding && (p_item->populate_on_expand || (p_item->first_child && p_item->get_visible_child_count() != 0))) { //has visible children, draw the guide box
 
 			Ref<Texture2D> arrow;
 
@@ -2736,7 +2760,7 @@ int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, int
 			return -1;
 		}
 
-		if (!p_item->disable_folding && !hide_folding && p_item->first_child && (p_pos.x >= x_ofs && p_pos.x < (x_ofs + theme_cache.item_margin))) {
+		if (!p_item->disable_folding && !hide_folding && (p_item->first_child || p_item->populate_on_expand) && (p_pos.x >= x_ofs && p_pos.x < (x_ofs + theme_cache.item_margin))) {
 			if (enable_recursive_folding && p_mod->is_shift_pressed()) {
 				p_item->set_collapsed_recursive(!p_item->is_collapsed());
 			} else {
@@ -3214,7 +3238,7 @@ void Tree::_go_left() {
 
 void Tree::_go_right() {
 	if (selected_col == (columns.size() - 1)) {
-		if (selected_item->get_first_child() != nullptr && selected_item->is_collapsed()) {
+		if ((selected_item->get_first_child() != nullptr || selected_item->is_populate_on_expand()) && selected_item->is_collapsed()) {
 			selected_item->set_collapsed(false);
 		} else if (selected_item->get_next_visible()) {
 			selected_col = 0;
@@ -5412,6 +5436,30 @@ bool Tree::get_allow_search() const {
 	return allow_search;
 }
 
+void Tree::set_populate_callback(const Callable &p_callback) {
+	populate_callback = p_callback;
+}
+
+Callable Tree::get_populate_callback() const {
+	return populate_callback;
+}
+
+void Tree::_populate_item(TreeItem *p_item) {
+	if (!populate_callback.is_valid()) {
+		return;
+	}
+
+	Variant item = p_item;
+	const Variant *args[1] = { &item };
+	Variant ret;
+	Callable::CallError ce;
+	populate_callback.callp(args, 1, ret, ce);
+	if (ce.error != Callable::CallError::CALL_OK) {
+		ERR_PRINT("Error calling the populate callback: " + Variant::get_callable_error_text(populate_callback, args, 1, ce) + ".");
+	}
+	queue_redraw();
+}
+
 void Tree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("clear"), &Tree::clear);
 	ClassDB::bind_method(D_METHOD("create_item", "parent", "index"), &Tree::create_item, DEFVAL(Variant()), DEFVAL(-1));
@@ -5495,6 +5543,9 @@ void Tree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_allow_search", "allow"), &Tree::set_allow_search);
 	ClassDB::bind_method(D_METHOD("get_allow_search"), &Tree::get_allow_search);
 
+	ClassDB::bind_method(D_METHOD("set_populate_callback", "callback"), &Tree::set_populate_callback);
+	ClassDB::bind_method(D_METHOD("get_populate_callback"), &Tree::get_populate_callback);
+
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "columns"), "set_columns", "get_columns");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "column_titles_visible"), "set_column_titles_visible", "are_column_titles_visible");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "allow_reselect"), "set_allow_reselect", "get_allow_reselect");
@@ -131,6 +131,7 @@ private:
 	bool collapsed = false; // won't show children
 	bool visible = true;
 	bool disable_folding = false;
+	bool populate_on_expand = false; // Children are created by Tree::populate_callback when first expanded.
 	int custom_min_height = 0;
 
 	TreeItem *parent = nullptr; // parent item
@@ -294,6 +295,9 @@ public:
 	void set_collapsed_recursive(bool p_collapsed);
 	bool is_any_collapsed(bool p_only_visible = false);
 
+	void set_populate_on_expand(bool p_enable);
+	bool is_populate_on_expand() const;
+
 	void set_visible(bool p_visible);
 	bool is_visible();
 
@@ -659,6 +663,9 @@ private:
 
 	bool enable_recursive_folding = true;
 
+	Callable populate_callback;
+	void _populate_item(TreeItem *p_item);
+
 	int _count_selected_items(TreeItem *p_from) const;
 	bool _is_branch_selected(TreeItem *p_from) const;
 	bool _is_sibling_branch_selected(TreeItem *p_from) const;
@@ -786,6 +793,9 @@ public:
 	void set_allow_search(bool p_allow);
 	bool get_allow_search() const;
 
+	void set_populate_callback(const Callable &p_callback);
+	Callable get_populate_callback() const;
+
 	Size2 get_minimum_size() const override;
 
 	Tree();
@@ -311,7 +311,7 @@ void Node::_propagate_after_exit_tree() {
 
 	data.blocked++;
 
-	for (HashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
+	for (SmallHashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
 		I->value->_propagate_after_exit_tree();
 	}
 
@@ -331,7 +331,7 @@ void Node::_propagate_exit_tree() {
 #endif
 	data.blocked++;
 
-	for (HashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
+	for (SmallHashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
 		I->value->_propagate_exit_tree();
 	}
 
@@ -2015,17 +2015,15 @@ void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 
 void Node::remove_from_group(const StringName &p_identifier) {
 	ERR_THREAD_GUARD
-	HashMap<StringName, GroupData>::Iterator E = data.grouped.find(p_identifier);
-
-	if (!E) {
+	if (!data.grouped.has(p_identifier)) {
 		return;
 	}
 
 	if (data.tree) {
-		data.tree->remove_from_group(E->key, this);
+		data.tree->remove_from_group(p_identifier, this);
 	}
 
-	data.grouped.remove(E);
+	data.grouped.erase(p_identifier);
 }
 
 TypedArray<StringName> Node::_get_groups() const {
@@ -2101,7 +2099,7 @@ String Node::get_tree_string() {
 void Node::_propagate_reverse_notification(int p_notification) {
 	data.blocked++;
 
-	for (HashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
+	for (SmallHashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
 		I->value->_propagate_reverse_notification(p_notification);
 	}
 
@@ -34,6 +34,7 @@
 
 #include "core/string/node_path.h"
 #include "core/templates/rb_map.h"
+#include "core/templates/small_hash_map.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/scene_tree.h"
 #include "scene/scene_string_names.h"
@@ -152,10 +153,10 @@ private:
 
 		Node *parent = nullptr;
 		Node *owner = nullptr;
-		HashMap<StringName, Node *> children;
+		SmallHashMap<StringName, Node *> children;
 		mutable bool children_cache_dirty = true;
 		mutable LocalVector<Node *> children_cache;
-		HashMap<StringName, Node *> owned_unique_nodes;
+		SmallHashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
 		InternalMode internal_mode = INTERNAL_MODE_DISABLED;
 		mutable int internal_children_front_count_cache = 0;
@@ -176,7 +177,7 @@ private:
 
 		Viewport *viewport = nullptr;
 
-		HashMap<StringName, GroupData> grouped;
+		SmallHashMap<StringName, GroupData> grouped;
 		List<Node *>::Element *OW = nullptr; // Owned element.
 		List<Node *> owned;
 
@@ -219,6 +219,73 @@ void SceneTree::_update_group_order(Group &g) {
 	g.changed = false;
 }
 
+void SceneTree::_group_call_threaded_task(uint32_t p_index, GroupCallThreaded *p_call) {
+	const GroupCallThreadTask &task = p_call->tasks[p_index];
+
+	// Nodes of a sub-thread process group are only accessible from the thread processing that group.
+	Node::current_process_thread_group = task.owner;
+	for (Node *node : task.nodes) {
+		if (p_call->is_notification) {
+			node->notification(p_call->notification, p_call->reverse);
+		} else {
+			Callable::CallError ce;
+			node->callp(p_call->function, p_call->args, p_call->argcount, ce);
+		}
+	}
+	Node::current_process_thread_group = nullptr;
+}
+
+void SceneTree::_group_call_threaded(GroupCallThreaded &p_call, Node **p_nodes, int p_node_count) {
+	// Only nodes belonging to sub-thread process groups are safe to call from other threads.
+	// Each of those groups becomes a task, so nodes of the same group are still called serially and in order.
+	// Anything else is called afterwards on this thread.
+	HashMap<Node *, uint32_t> task_indices;
+	LocalVector<Node *> main_thread_nodes;
+
+	for (int i = 0; i < p_node_count; i++) {
+		Node *node = p_nodes[p_call.reverse ? p_node_count - 1 - i : i];
+		if (nodes_removed_on_group_call.has(node)) {
+			continue;
+		}
+
+		Node *owner = node->data.process_thread_group_owner;
+		if (owner == nullptr || owner->data.process_thread_group != Node::PROCESS_THREAD_GROUP_SUB_THREAD) {
+			main_thread_nodes.push_back(node);
+			continue;
+		}
+
+		const uint32_t *index = task_indices.getptr(owner);
+		if (index) {
+			p_call.tasks[*index].nodes.push_back(node);
+		} else {
+			task_indices.insert(owner, p_call.tasks.size());
+			GroupCallThreadTask task;
+			task.owner = owner;
+			task.nodes.push_back(node);
+			p_call.tasks.push_back(task);
+		}
+	}
+
+	if (!p_call.tasks.is_empty()) {
+		WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_group_call_threaded_task, &p_call, p_call.tasks.size(), -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+	}
+
+	for (Node *node : main_thread_nodes) {
+		if (nodes_removed_on_group_call.has(node)) {
+			// May have been removed by a previous call.
+			continue;
+		}
+
+		if (p_call.is_notification) {
+			node->notification(p_call.notification, p_call.reverse);
+		} else {
+			Callable::CallError ce;
+			node->callp(p_call.function, p_call.args, p_call.argcount, ce);
+		}
+	}
+}
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
 	Vector<Node *> nodes_copy;
 
@@ -266,7 +333,15 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_removed_on_group_call_lock++;
 	}
 
-	if (p_call_flags & GROUP_CALL_REVERSE) {
+	if ((p_call_flags & GROUP_CALL_THREADED) && !(p_call_flags & GROUP_CALL_DEFERRED) && !node_threading_disabled && is_current_thread_safe_for_nodes()) {
+		GroupCallThreaded call;
+		call.function = p_function;
+		call.args = p_args;
+		call.argcount = p_argcount;
+		call.reverse = p_call_flags & GROUP_CALL_REVERSE;
+		_group_call_threaded(call, gr_nodes, gr_node_count);
+
+	} else if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = gr_node_count - 1; i >= 0; i--) {
 			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
 				continue;
@@ -330,7 +405,14 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_removed_on_group_call_lock++;
 	}
 
-	if (p_call_flags & GROUP_CALL_REVERSE) {
+	if ((p_call_flags & GROUP_CALL_THREADED) && !(p_call_flags & GROUP_CALL_DEFERRED) && !node_threading_disabled && is_current_thread_safe_for_nodes()) {
+		GroupCallThreaded call;
+		call.notification = p_notification;
+		call.is_notification = true;
+		call.reverse = p_call_flags & GROUP_CALL_REVERSE;
+		_group_call_threaded(call, gr_nodes, gr_node_count);
+
+	} else if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = gr_node_count - 1; i >= 0; i--) {
 			if (nodes_removed_on_group_call.has(gr_nodes[i])) {
 				continue;
@@ -483,6 +565,17 @@ bool SceneTree::process(double p_time) {
 
 	process_time = p_time;
 
+	Viewport::gui_layout_stats_last_frame = Viewport::gui_layout_stats;
+	Viewport::gui_layout_stats = Viewport::GUILayoutStats();
+
+	if (glyph_cache_budget > 0) {
+		glyph_cache_trim_time += p_time;
+		if (glyph_cache_trim_time >= 1.0) {
+			glyph_cache_trim_time = 0.0;
+			_trim_glyph_cache();
+		}
+	}
+
 	emit_signal(SNAME("process_frame"));
 
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -707,6 +800,31 @@ bool SceneTree::is_paused() const {
 	return paused;
 }
 
+void SceneTree::_update_process_batches(const Vector<Node *> &p_nodes, Vector<ProcessBatchCallback> &r_batches, uint32_t &r_version) const {
+	MutexLock lock(process_batch_callbacks_mutex);
+	r_version = process_batch_callbacks_version.get();
+
+	if (process_batch_callbacks.is_empty()) {
+		r_batches.clear();
+		return;
+	}
+
+	r_batches.resize(p_nodes.size());
+	ProcessBatchCallback *batches_ptr = r_batches.ptrw();
+	const Node *const *nodes_ptr = p_nodes.ptr();
+	bool batched = false;
+
+	for (int i = 0; i < p_nodes.size(); i++) {
+		const ProcessBatchCallback *callback = process_batch_callbacks.getptr(nodes_ptr[i]->get_class_name());
+		batches_ptr[i] = callback ? *callback : nullptr;
+		batched = batched || callback;
+	}
+
+	if (!batched) {
+		r_batches.clear();
+	}
+}
+
 void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
@@ -718,27 +836,43 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 		return;
 	}
 
+	Vector<ProcessBatchCallback> &batches = p_physics ? p_group->physics_node_batches : p_group->node_batches;
+
+	uint32_t &batches_version = p_physics ? p_group->physics_node_batches_version : p_group->node_batches_version;
+	bool batches_dirty = batches_version != process_batch_callbacks_version.get();
+
 	if (p_physics) {
 		if (p_group->physics_node_order_dirty) {
 			nodes.sort_custom<Node::ComparatorWithPhysicsPriority>();
+			batches_dirty = true;
 			p_group->physics_node_order_dirty = false;
 		}
 	} else {
 		if (p_group->node_order_dirty) {
 			nodes.sort_custom<Node::ComparatorWithPriority>();
+			batches_dirty = true;
 			p_group->node_order_dirty = false;
 		}
 	}
 
+	if (batches_dirty) {
+		_update_process_batches(nodes, batches, batches_version);
+	}
+
 	// Make a copy, so if nodes are added/removed from process, this does not break
 	Vector<Node *> nodes_copy = nodes;
+	Vector<ProcessBatchCallback> batches_copy = batches;
 
 	uint32_t node_count = nodes_copy.size();
 	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+	const ProcessBatchCallback *batches_ptr = batches_copy.is_empty() ? nullptr : batches_copy.ptr();
+
+	LocalVector<Node *> &batch_buffer = p_group->batch_buffer;
+	ProcessBatchCallback pending_batch = nullptr;
 
 	for (uint32_t i = 0; i < node_count; i++) {
 		Node *n = nodes_ptr[i];
-		if (nodes_removed_on_group_call.has(n)) {
+		if (!nodes_removed_on_group_call.is_empty() && nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
 			// Keep in mind removals can only happen on the main thread.
 			continue;
@@ -748,6 +882,22 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			continue;
 		}
 
+		// Scripts may override the process callbacks, so those nodes are always notified individually.
+		ProcessBatchCallback batch = batches_ptr && !n->get_script_instance() ? batches_ptr[i] : nullptr;
+
+		if (pending_batch && batch != pending_batch) {
+			// The run of consecutive nodes sharing a batch ended, process it before moving on to keep the priority order.
+			pending_batch(batch_buffer.ptr(), batch_buffer.size(), p_physics);
+			batch_buffer.clear();
+			pending_batch = nullptr;
+		}
+
+		if (batch) {
+			batch_buffer.push_back(n);
+			pending_batch = batch;
+			continue;
+		}
+
 		if (p_physics) {
 			if (n->is_physics_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
@@ -765,6 +915,11 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 		}
 	}
 
+	if (pending_batch) {
+		pending_batch(batch_buffer.ptr(), batch_buffer.size(), p_physics);
+		batch_buffer.clear();
+	}
+
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
@@ -935,13 +1090,21 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		bool found = pg->nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		int index = pg->nodes.find(p_node);
+		ERR_FAIL_COND(index == -1);
+		pg->nodes.remove_at(index);
+		if (!pg->node_order_dirty && !pg->node_batches.is_empty()) {
+			pg->node_batches.remove_at(index); // Keep batches parallel to the nodes, order is preserved.
+		}
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		bool found = pg->physics_nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		int index = pg->physics_nodes.find(p_node);
+		ERR_FAIL_COND(index == -1);
+		pg->physics_nodes.remove_at(index);
+		if (!pg->physics_node_order_dirty && !pg->physics_node_batches.is_empty()) {
+			pg->physics_node_batches.remove_at(index);
+		}
 	}
 }
 
@@ -1148,6 +1311,36 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	}
 }
 
+void SceneTree::_trim_glyph_cache() {
+	// Evicted glyphs are rasterized again when drawn. Canvas items that drew them are redrawn,
+	// as they still refer to their textures.
+	const TypedArray<RID> canvas_items = TS->font_trim_global_glyph_cache(glyph_cache_budget);
+	if (canvas_items.is_empty()) {
+		return;
+	}
+
+	if (canvas_items.has(RID())) {
+		_redraw_canvas_items(root, nullptr);
+	} else {
+		HashSet<RID> redraw;
+		for (int i = 0; i < canvas_items.size(); i++) {
+			redraw.insert(canvas_items[i]);
+		}
+		_redraw_canvas_items(root, &redraw);
+	}
+}
+
+void SceneTree::_redraw_canvas_items(Node *p_node, const HashSet<RID> *p_canvas_items) {
+	CanvasItem *ci = Object::cast_to<CanvasItem>(p_node);
+	if (ci && (!p_canvas_items || p_canvas_items->has(ci->get_canvas_item()))) {
+		ci->queue_redraw();
+	}
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_redraw_canvas_items(p_node->get_child(i), p_canvas_items);
+	}
+}
+
 void SceneTree::_flush_delete_queue() {
 	_THREAD_SAFE_METHOD_
 
@@ -1376,6 +1569,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_THREADED);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
@@ -1394,6 +1588,25 @@ void SceneTree::add_idle_callback(IdleCallback p_callback) {
 	idle_callbacks[idle_callback_count++] = p_callback;
 }
 
+void SceneTree::set_process_batch_callback(const StringName &p_class, ProcessBatchCallback p_callback) {
+	MutexLock lock(process_batch_callbacks_mutex);
+
+	if (p_callback) {
+		process_batch_callbacks[p_class] = p_callback;
+	} else {
+		process_batch_callbacks.erase(p_class);
+	}
+
+	// Groups compare against this when processed, and resolve their batches again if it changed.
+	process_batch_callbacks_version.increment();
+}
+
+SceneTree::ProcessBatchCallback SceneTree::get_process_batch_callback(const StringName &p_class) const {
+	MutexLock lock(process_batch_callbacks_mutex);
+	const ProcessBatchCallback *callback = process_batch_callbacks.getptr(p_class);
+	return callback ? *callback : nullptr;
+}
+
 void SceneTree::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 	if (p_function == "change_scene_to_file") {
 		Ref<DirAccess> dir_access = DirAccess::create(DirAccess::ACCESS_RESOURCES);
@@ -1437,6 +1650,8 @@ SceneTree::SceneTree() {
 	debug_paths_color = GLOBAL_DEF("debug/shapes/paths/geometry_color", Color(0.1, 1.0, 0.7, 0.4));
 	debug_paths_width = GLOBAL_DEF("debug/shapes/paths/geometry_width", 2.0);
 
+	glyph_cache_budget = int64_t(GLOBAL_DEF(PropertyInfo(Variant::INT, "gui/fonts/dynamic_fonts/glyph_cache_budget", PROPERTY_HINT_RANGE, "0,4096,1,or_greater,suffix:MiB"), 0)) * 1024 * 1024;
+
 	process_group_call_queue_allocator = memnew(CallQueue::Allocator(64));
 	Math::randomize();
 
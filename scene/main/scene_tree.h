@@ -35,6 +35,7 @@
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 
 #undef Window
@@ -83,6 +84,9 @@ class SceneTree : public MainLoop {
 
 public:
 	typedef void (*IdleCallback)();
+	// Processes a packed run of nodes of the same class in a single call,
+	// instead of sending them the (internal) process notifications one by one.
+	typedef void (*ProcessBatchCallback)(Node *const *p_nodes, uint32_t p_count, bool p_physics);
 
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
@@ -91,6 +95,11 @@ private:
 		CallQueue call_queue;
 		Vector<Node *> nodes;
 		Vector<Node *> physics_nodes;
+		Vector<ProcessBatchCallback> node_batches; // Parallel to nodes, empty unless some node is batched.
+		Vector<ProcessBatchCallback> physics_node_batches; // Parallel to physics_nodes.
+		LocalVector<Node *> batch_buffer;
+		uint32_t node_batches_version = 0; // Registry version the batches were resolved against.
+		uint32_t physics_node_batches_version = 0;
 		bool node_order_dirty = true;
 		bool physics_node_order_dirty = true;
 		bool removed = false;
@@ -113,6 +122,11 @@ private:
 
 	bool node_threading_disabled = false;
 
+	// Read by groups processed on worker threads, so it's guarded by its own mutex.
+	mutable Mutex process_batch_callbacks_mutex;
+	HashMap<StringName, ProcessBatchCallback> process_batch_callbacks;
+	SafeNumeric<uint32_t> process_batch_callbacks_version;
+
 	struct Group {
 		Vector<Node *> nodes;
 		bool changed = false;
@@ -125,6 +139,9 @@ private:
 	double process_time = 0.0;
 	bool accept_quit = true;
 
+	int64_t glyph_cache_budget = 0;
+	double glyph_cache_trim_time = 0.0;
+
 #ifdef DEBUG_ENABLED
 	bool debug_paths_hint = false;
 #endif
@@ -164,6 +181,25 @@ private:
 
 	List<ObjectID> delete_queue;
 
+	// Group calls spread over the worker threads, one task per sub-thread process group.
+	struct GroupCallThreadTask {
+		Node *owner = nullptr;
+		LocalVector<Node *> nodes;
+	};
+
+	struct GroupCallThreaded {
+		LocalVector<GroupCallThreadTask> tasks;
+		StringName function;
+		const Variant **args = nullptr;
+		int argcount = 0;
+		int notification = 0;
+		bool is_notification = false;
+		bool reverse = false;
+	};
+
+	void _group_call_threaded_task(uint32_t p_index, GroupCallThreaded *p_call);
+	void _group_call_threaded(GroupCallThreaded &p_call, Node **p_nodes, int p_node_count);
+
 	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
 	bool ugc_locked = false;
 	void _flush_ugc();
@@ -198,6 +234,7 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
+	void _update_process_batches(const Vector<Node *> &p_nodes, Vector<ProcessBatchCallback> &r_batches, uint32_t &r_version) const;
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
@@ -211,6 +248,8 @@ private:
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	void _flush_delete_queue();
+	void _trim_glyph_cache();
+	void _redraw_canvas_items(Node *p_node, const HashSet<RID> *p_canvas_items);
 	// Optimization.
 	friend class CanvasItem;
 	friend class Viewport;
@@ -256,6 +295,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_DEFERRED = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_THREADED = 8,
 	};
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
@@ -367,6 +407,9 @@ public:
 
 	static void add_idle_callback(IdleCallback p_callback);
 
+	void set_process_batch_callback(const StringName &p_class, ProcessBatchCallback p_callback);
+	ProcessBatchCallback get_process_batch_callback(const StringName &p_class) const;
+
 	void set_disable_node_threading(bool p_disable);
 	//default texture settings
 
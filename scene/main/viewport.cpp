@@ -38,6 +38,7 @@
 #include "core/templates/pair.h"
 #include "core/templates/sort_array.h"
 #include "scene/2d/camera_2d.h"
+#include "scene/gui/container.h"
 #include "scene/gui/control.h"
 #include "scene/gui/label.h"
 #include "scene/gui/popup.h"
@@ -648,6 +649,87 @@ Rect2 Viewport::get_visible_rect() const {
 	return r;
 }
 
+Viewport::GUILayoutStats Viewport::gui_layout_stats;
+Viewport::GUILayoutStats Viewport::gui_layout_stats_last_frame;
+
+static int _get_layout_depth(const Node *p_node) {
+	int depth = 0;
+	for (const Node *n = p_node->get_parent(); n; n = n->get_parent()) {
+		depth++;
+	}
+	return depth;
+}
+
+// Takes the queued nodes out of p_dirty, ordered by depth (deepest first if p_bottom_up).
+template <typename T>
+static void _take_layout_batch(HashSet<ObjectID> &p_dirty, bool p_bottom_up, LocalVector<Pair<int, T *>> &r_batch) {
+	r_batch.clear();
+	for (const ObjectID &id : p_dirty) {
+		T *node = Object::cast_to<T>(ObjectDB::get_instance(id));
+		if (node) {
+			int depth = _get_layout_depth(node);
+			r_batch.push_back(Pair<int, T *>(p_bottom_up ? -depth : depth, node));
+		}
+	}
+	p_dirty.clear();
+
+	SortArray<Pair<int, T *>, PairSort<int, T *>> sorter;
+	sorter.sort(r_batch.ptr(), r_batch.size());
+}
+
+void Viewport::_gui_queue_layout_update() {
+	if (gui.layout_update_queued) {
+		return;
+	}
+	gui.layout_update_queued = true;
+	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Viewport::_gui_process_layout));
+}
+
+void Viewport::_gui_process_layout() {
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	uint32_t control_count = 0;
+
+	// Minimum sizes are resolved bottom-up, so each parent sees the final sizes of its children
+	// and is updated once. Containers are then sorted top-down, so children are placed inside their
+	// final rects. Both steps can queue more work (a new minimum size needs a sort, and a sort can
+	// change the minimum size of wrapping controls), which is handled here until the layout settles.
+	LocalVector<Pair<int, Control *>> controls;
+	LocalVector<Pair<int, Container *>> containers;
+	while (!gui.controls_with_dirty_minimum_size.is_empty() || !gui.containers_with_dirty_sort.is_empty()) {
+		if (!gui.controls_with_dirty_minimum_size.is_empty()) {
+			_take_layout_batch(gui.controls_with_dirty_minimum_size, true, controls);
+			for (const Pair<int, Control *> &E : controls) {
+				E.second->_update_minimum_size();
+			}
+			control_count += controls.size();
+			continue;
+		}
+
+		_take_layout_batch(gui.containers_with_dirty_sort, false, containers);
+		for (const Pair<int, Container *> &E : containers) {
+			E.second->_sort_children();
+		}
+		control_count += containers.size();
+	}
+
+	gui.layout_update_queued = false;
+
+	gui_layout_stats.time_usec += OS::get_singleton()->get_ticks_usec() - begin;
+	gui_layout_stats.control_count += control_count;
+}
+
+void Viewport::gui_queue_minimum_size_update(Control *p_control) {
+	ERR_MAIN_THREAD_GUARD;
+	gui.controls_with_dirty_minimum_size.insert(p_control->get_instance_id());
+	_gui_queue_layout_update();
+}
+
+void Viewport::gui_queue_sort(Container *p_container) {
+	ERR_MAIN_THREAD_GUARD;
+	gui.containers_with_dirty_sort.insert(p_container->get_instance_id());
+	_gui_queue_layout_update();
+}
+
 void Viewport::canvas_parent_mark_dirty(Node *p_node) {
 	ERR_MAIN_THREAD_GUARD;
 	bool request_update = gui.canvas_parents_with_dirty_order.is_empty();
@@ -3438,6 +3520,21 @@ Viewport::~Viewport() {
 	for (ViewportTexture *E : viewport_textures) {
 		E->vp = nullptr;
 	}
+
+	// Controls that moved to another viewport while queued must be able to queue again.
+	for (const ObjectID &id : gui.controls_with_dirty_minimum_size) {
+		Control *c = Object::cast_to<Control>(ObjectDB::get_instance(id));
+		if (c) {
+			c->data.updating_last_minimum_size = false;
+		}
+	}
+	for (const ObjectID &id : gui.containers_with_dirty_sort) {
+		Container *c = Object::cast_to<Container>(ObjectDB::get_instance(id));
+		if (c) {
+			c->pending_sort = false;
+		}
+	}
+
 	ERR_FAIL_NULL(RenderingServer::get_singleton());
 	RenderingServer::get_singleton()->free(viewport);
 }
@@ -39,6 +39,7 @@ class Camera2D;
 class CanvasItem;
 class CanvasLayer;
 class Control;
+class Container;
 class Label;
 class SceneTreeTimer;
 class Viewport;
@@ -272,6 +273,9 @@ private:
 		bool roots_order_dirty = false;
 		List<Control *> roots;
 		HashSet<ObjectID> canvas_parents_with_dirty_order;
+		HashSet<ObjectID> controls_with_dirty_minimum_size;
+		HashSet<ObjectID> containers_with_dirty_sort;
+		bool layout_update_queued = false;
 		int canvas_sort_index = 0; //for sorting items with canvas as root
 		bool dragging = false;
 		bool drag_successful = false;
@@ -369,6 +373,9 @@ private:
 
 	void _process_dirty_canvas_parent_orders();
 
+	void _gui_queue_layout_update();
+	void _gui_process_layout();
+
 protected:
 	void _set_size(const Size2i &p_size, const Size2i &p_size_2d_override, bool p_allocated);
 
@@ -381,6 +388,17 @@ protected:
 
 public:
 	void canvas_parent_mark_dirty(Node *p_node);
+
+	// Layout of the controls in this viewport, resolved once per batch of changes.
+	struct GUILayoutStats {
+		uint64_t time_usec = 0;
+		uint32_t control_count = 0;
+	};
+	static GUILayoutStats gui_layout_stats; // Since the start of the current frame.
+	static GUILayoutStats gui_layout_stats_last_frame;
+
+	void gui_queue_minimum_size_update(Control *p_control);
+	void gui_queue_sort(Container *p_container);
 	void canvas_item_top_level_changed();
 
 	uint64_t get_processed_events_count() const { return event_count; }
@@ -123,6 +123,60 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+const LocalVector<SceneState::NodeInstantiationPlan> &SceneState::_get_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+
+	if (!instantiation_plan_dirty) {
+		return instantiation_plan;
+	}
+
+	instantiation_plan.clear();
+	instantiation_plan.resize(nodes.size());
+
+	const NodeData *nd = nodes.ptr();
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nd[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue; // Not created from a class, the node type is only known when instantiating.
+		}
+
+		const StringName &type = names[n.type];
+		if (!ClassDB::is_parent_class(type, SNAME("Node"))) {
+			continue;
+		}
+
+		NodeInstantiationPlan &plan = instantiation_plan[i];
+		plan.creation_func = ClassDB::get_native_creation_func(type);
+		if (!plan.creation_func) {
+			continue;
+		}
+
+		plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			plan.setters[j] = nullptr;
+
+			const NodeData::Property &prop = n.properties[j];
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size() || names[prop.name] == CoreStringName(script)) {
+				continue;
+			}
+
+			const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(type, names[prop.name]);
+			if (psg && psg->_setptr) {
+				plan.setters[j] = psg;
+			}
+		}
+	}
+
+	instantiation_plan_dirty = false;
+	return instantiation_plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan.clear();
+	instantiation_plan_dirty = true;
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -160,6 +214,14 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
 
+	// Editor instantiations may diverge from the stored data (placeholders, missing classes), so only use the plan at runtime.
+	const NodeInstantiationPlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED) {
+		const LocalVector<NodeInstantiationPlan> &instantiation_plan_ref = _get_instantiation_plan();
+		ERR_FAIL_COND_V(instantiation_plan_ref.size() != (uint32_t)nc, nullptr);
+		plan = instantiation_plan_ref.ptr();
+	}
+
 	HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_scene;
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
@@ -189,6 +251,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
+		const ClassDB::PropertySetGet *const *setters = nullptr;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			//scene inheritance on root node
@@ -234,7 +297,13 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			//node belongs to this scene and must be created
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = nullptr;
+			if (plan && plan[i].creation_func) {
+				obj = plan[i].creation_func();
+				setters = plan[i].setters.ptr();
+			} else {
+				obj = ClassDB::instantiate(snames[n.type]);
+			}
 
 			node = Object::cast_to<Node>(obj);
 
@@ -373,7 +442,21 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							const ClassDB::PropertySetGet *psg = setters ? setters[j] : nullptr;
+							if (psg && !node->get_script_instance()) {
+								// Same as ClassDB::set_property(), with the setter already resolved.
+								Callable::CallError ce;
+								if (psg->index >= 0) {
+									Variant index = psg->index;
+									const Variant *args[2] = { &index, &value };
+									psg->_setptr->call(node, args, 2, ce);
+								} else {
+									const Variant *args[1] = { &value };
+									psg->_setptr->call(node, args, 1, ce);
+								}
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -1116,6 +1199,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1331,6 +1415,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -1794,6 +1880,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.index = p_index;
 
 	nodes.push_back(nd);
+	_clear_instantiation_plan();
 
 	return nodes.size() - 1;
 }
@@ -1810,6 +1897,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	_clear_instantiation_plan();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -1901,10 +1989,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_pool();
 	state->clear();
 }
 
@@ -1919,6 +2009,8 @@ void PackedScene::reload_from_file() {
 		return;
 	}
 
+	clear_pool();
+
 	// Backup the loaded_state
 	Ref<SceneState> loaded_state = s->get_state();
 	// This assigns a new state to s->state
@@ -1958,6 +2050,7 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1966,6 +2059,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1977,6 +2071,242 @@ Ref<SceneState> PackedScene::get_state() const {
 	return state;
 }
 
+void PackedScene::_pool_snapshot_node(Node *p_node, PooledInstance &r_instance) {
+	PooledNode pooled_node;
+	pooled_node.id = p_node->get_instance_id();
+	if (!r_instance.nodes.is_empty()) {
+		pooled_node.parent = p_node->get_parent()->get_instance_id();
+	}
+
+	List<PropertyInfo> properties;
+	p_node->get_property_list(&properties);
+	for (const PropertyInfo &E : properties) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringName(script)) {
+			continue;
+		}
+		Variant value = p_node->get(E.name);
+		if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+			value = value.duplicate(); // Don't let in-place changes leak into the snapshot.
+		}
+		pooled_node.properties.push_back(Pair<StringName, Variant>(E.name, value));
+	}
+	r_instance.property_count += pooled_node.properties.size();
+
+	List<Node::GroupInfo> groups;
+	p_node->get_groups(&groups);
+	for (const Node::GroupInfo &E : groups) {
+		pooled_node.groups.push_back(E.name);
+	}
+
+	r_instance.nodes.push_back(pooled_node);
+
+	// Internal children are snapshotted too, as they are part of what the instance looks like when created.
+	for (int i = 0; i < p_node->get_child_count(true); i++) {
+		_pool_snapshot_node(p_node->get_child(i, true), r_instance);
+	}
+}
+
+bool PackedScene::_pool_reset_instance(const PooledInstance &p_instance) {
+	// Make sure the instance still has the structure it was created with, otherwise it can't be reused.
+	HashSet<ObjectID> ids;
+	for (const PooledNode &pooled_node : p_instance.nodes) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(pooled_node.id));
+		if (!node) {
+			return false;
+		}
+		Node *parent = node->get_parent();
+		if (pooled_node.parent.is_valid() ? (!parent || parent->get_instance_id() != pooled_node.parent) : parent != nullptr) {
+			return false;
+		}
+		ids.insert(pooled_node.id);
+	}
+
+	for (const PooledNode &pooled_node : p_instance.nodes) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(pooled_node.id));
+
+		// Nodes added after instantiation don't belong to the scene.
+		for (int i = node->get_child_count(true) - 1; i >= 0; i--) {
+			Node *child = node->get_child(i, true);
+			if (!ids.has(child->get_instance_id())) {
+				node->remove_child(child);
+				memdelete(child);
+			}
+		}
+
+		// Only set what changed, so setters with side effects don't run needlessly.
+		for (const Pair<StringName, Variant> &E : pooled_node.properties) {
+			bool valid = false;
+			Variant current = node->get(E.first, &valid);
+			if (!valid || current.get_type() != E.second.get_type() || current != E.second) {
+				bool is_container = E.second.get_type() == Variant::ARRAY || E.second.get_type() == Variant::DICTIONARY;
+				node->set(E.first, is_container ? E.second.duplicate() : E.second);
+			}
+		}
+
+		List<Node::GroupInfo> groups;
+		node->get_groups(&groups);
+		for (const Node::GroupInfo &E : groups) {
+			if (pooled_node.groups.find(E.name) == -1) {
+				node->remove_from_group(E.name);
+			}
+		}
+		for (const StringName &E : pooled_node.groups) {
+			if (!node->is_in_group(E)) {
+				node->add_to_group(E, true);
+			}
+		}
+	}
+
+	return true;
+}
+
+void PackedScene::_pool_free_instance(const PooledInstance &p_instance) {
+	Node *root = Object::cast_to<Node>(ObjectDB::get_instance(p_instance.nodes[0].id));
+	if (root && !root->get_parent()) {
+		memdelete(root);
+	}
+}
+
+Node *PackedScene::acquire_instance() {
+	{
+		MutexLock lock(pool_mutex);
+		while (!pool.is_empty()) {
+			PooledInstance instance = pool[pool.size() - 1];
+			pool.remove_at(pool.size() - 1);
+
+			Node *root = Object::cast_to<Node>(ObjectDB::get_instance(instance.nodes[0].id));
+			if (!root) {
+				continue; // Freed while pooled.
+			}
+
+			pool_hits++;
+			pool_acquired.insert(instance.nodes[0].id, instance);
+			return root;
+		}
+		pool_misses++;
+	}
+
+	Node *root = instantiate();
+	ERR_FAIL_NULL_V(root, nullptr);
+
+	PooledInstance instance;
+	_pool_snapshot_node(root, instance);
+
+	MutexLock lock(pool_mutex);
+	if (pool_acquired.size() >= pool_acquired_prune_size) {
+		// Forget instances that were freed instead of released, so they don't accumulate.
+		LocalVector<ObjectID> freed;
+		for (const KeyValue<ObjectID, PooledInstance> &E : pool_acquired) {
+			if (!ObjectDB::get_instance(E.key)) {
+				freed.push_back(E.key);
+			}
+		}
+		for (const ObjectID &E : freed) {
+			pool_acquired.erase(E);
+		}
+		pool_acquired_prune_size = MAX(64u, pool_acquired.size() * 2);
+	}
+	pool_acquired.insert(root->get_instance_id(), instance);
+
+	return root;
+}
+
+void PackedScene::release_instance(Node *p_instance) {
+	ERR_FAIL_NULL(p_instance);
+
+	PooledInstance instance;
+	{
+		MutexLock lock(pool_mutex);
+		HashMap<ObjectID, PooledInstance>::Iterator E = pool_acquired.find(p_instance->get_instance_id());
+		ERR_FAIL_COND_MSG(!E, "Node was not acquired from this scene with acquire_instance().");
+		instance = E->value;
+		pool_acquired.remove(E);
+	}
+
+	if (p_instance->get_parent()) {
+		p_instance->get_parent()->remove_child(p_instance);
+	}
+
+	bool keep = false;
+	{
+		MutexLock lock(pool_mutex);
+		keep = (int)pool.size() < pool_max_size;
+	}
+
+	if (!keep || !_pool_reset_instance(instance)) {
+		memdelete(p_instance);
+		return;
+	}
+
+	MutexLock lock(pool_mutex);
+	pool.push_back(instance);
+}
+
+void PackedScene::clear_pool() {
+	LocalVector<PooledInstance> to_free;
+	{
+		MutexLock lock(pool_mutex);
+		to_free = pool;
+		pool.clear();
+		pool_acquired.clear();
+		pool_hits = 0;
+		pool_misses = 0;
+	}
+
+	for (const PooledInstance &E : to_free) {
+		_pool_free_instance(E);
+	}
+}
+
+void PackedScene::set_pool_max_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+
+	LocalVector<PooledInstance> to_free;
+	{
+		MutexLock lock(pool_mutex);
+		pool_max_size = p_size;
+		while ((int)pool.size() > pool_max_size) {
+			to_free.push_back(pool[pool.size() - 1]);
+			pool.remove_at(pool.size() - 1);
+		}
+	}
+
+	for (const PooledInstance &E : to_free) {
+		_pool_free_instance(E);
+	}
+}
+
+int PackedScene::get_pool_max_size() const {
+	return pool_max_size;
+}
+
+Dictionary PackedScene::get_pool_stats() const {
+	MutexLock lock(pool_mutex);
+
+	uint32_t pooled_nodes = 0;
+	uint32_t pooled_properties = 0;
+	uint64_t pooled_snapshot_bytes = 0;
+	for (const PooledInstance &E : pool) {
+		pooled_nodes += E.nodes.size();
+		pooled_properties += E.property_count;
+		pooled_snapshot_bytes += sizeof(PooledInstance) + E.nodes.size() * sizeof(PooledNode);
+		for (const PooledNode &F : E.nodes) {
+			pooled_snapshot_bytes += F.properties.size() * sizeof(Pair<StringName, Variant>) + F.groups.size() * sizeof(StringName);
+		}
+	}
+
+	Dictionary stats;
+	stats["hits"] = pool_hits;
+	stats["misses"] = pool_misses;
+	stats["hit_rate"] = pool_hits + pool_misses > 0 ? double(pool_hits) / double(pool_hits + pool_misses) : 0.0;
+	stats["pooled_instances"] = pool.size();
+	stats["pooled_nodes"] = pooled_nodes;
+	stats["pooled_properties"] = pooled_properties;
+	stats["pooled_snapshot_bytes"] = pooled_snapshot_bytes;
+	stats["acquired_instances"] = pool_acquired.size();
+	return stats;
+}
+
 void PackedScene::set_path(const String &p_path, bool p_take_over) {
 	state->set_path(p_path);
 	Resource::set_path(p_path, p_take_over);
@@ -1992,6 +2322,12 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
+	ClassDB::bind_method(D_METHOD("acquire_instance"), &PackedScene::acquire_instance);
+	ClassDB::bind_method(D_METHOD("release_instance", "instance"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("set_pool_max_size", "size"), &PackedScene::set_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_max_size"), &PackedScene::get_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_stats"), &PackedScene::get_pool_stats);
 
 	ADD_PROPERTY(PropertyInfo(Variant::DICTIONARY, "_bundled"), "_set_bundled_scene", "_get_bundled_scene");
 
@@ -2004,3 +2340,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	clear_pool();
+}
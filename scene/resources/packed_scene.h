@@ -90,6 +90,20 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Resolved from the node data on the first runtime instantiation, so repeated instantiations
+	// can skip the class and property lookups. Rebuilt whenever the state changes.
+	struct NodeInstantiationPlan {
+		Object *(*creation_func)() = nullptr; // Only set for nodes created from a native class.
+		LocalVector<const ClassDB::PropertySetGet *> setters; // Parallel to NodeData::properties, null when Object::set() must be used.
+	};
+
+	mutable LocalVector<NodeInstantiationPlan> instantiation_plan;
+	mutable bool instantiation_plan_dirty = true;
+	mutable Mutex instantiation_plan_mutex;
+
+	const LocalVector<NodeInstantiationPlan> &_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -226,6 +240,31 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// Instances kept alive by release_instance() to be handed out again by acquire_instance().
+	struct PooledNode {
+		ObjectID id;
+		ObjectID parent;
+		LocalVector<Pair<StringName, Variant>> properties; // Stored properties right after instantiation.
+		LocalVector<StringName> groups;
+	};
+
+	struct PooledInstance {
+		LocalVector<PooledNode> nodes; // The first one is the instance root.
+		uint32_t property_count = 0;
+	};
+
+	mutable Mutex pool_mutex;
+	HashMap<ObjectID, PooledInstance> pool_acquired;
+	LocalVector<PooledInstance> pool;
+	int pool_max_size = 32;
+	uint64_t pool_hits = 0;
+	uint64_t pool_misses = 0;
+	uint32_t pool_acquired_prune_size = 64;
+
+	static void _pool_snapshot_node(Node *p_node, PooledInstance &r_instance);
+	static bool _pool_reset_instance(const PooledInstance &p_instance);
+	static void _pool_free_instance(const PooledInstance &p_instance);
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -264,7 +303,15 @@ public:
 #endif
 	Ref<SceneState> get_state() const;
 
+	Node *acquire_instance();
+	void release_instance(Node *p_instance);
+	void clear_pool();
+	void set_pool_max_size(int p_size);
+	int get_pool_max_size() const;
+	Dictionary get_pool_stats() const;
+
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
@@ -35,8 +35,15 @@
 #include "scene/gui/text_edit.h"
 
 Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
-	if (highlighting_cache.has(p_line)) {
-		return highlighting_cache[p_line];
+	if (p_line >= 0 && p_line < (int)highlighting_cache.size() && highlighting_cache[p_line].valid) {
+		if (!highlighting_cache[p_line].stale) {
+			return highlighting_cache[p_line].color_map;
+		}
+		// Script highlighters don't report their state, so their stale lines are always highlighted again.
+		if (!GDVIRTUAL_IS_OVERRIDDEN(_get_line_syntax_highlighting) && _is_stale_line_valid(p_line)) {
+			highlighting_cache[p_line].stale = false;
+			return highlighting_cache[p_line].color_map;
+		}
 	}
 
 	Dictionary color_map;
@@ -48,19 +55,40 @@ Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
 		color_map = _get_line_syntax_highlighting_impl(p_line);
 	}
 
-	highlighting_cache[p_line] = color_map;
+	if (p_line >= 0) {
+		if (p_line >= (int)highlighting_cache.size()) {
+			highlighting_cache.resize(p_line + 1);
+		}
+		CachedLine &cached_line = highlighting_cache[p_line];
+		cached_line.color_map = color_map;
+		cached_line.valid = true;
+		cached_line.stale = false;
+	}
 	return color_map;
 }
 
+bool SyntaxHighlighter::_is_line_cached(int p_line) const {
+	return p_line >= 0 && p_line < (int)highlighting_cache.size() && highlighting_cache[p_line].valid && !highlighting_cache[p_line].stale;
+}
+
 void SyntaxHighlighter::_lines_edited_from(int p_from_line, int p_to_line) {
-	if (highlighting_cache.size() < 1) {
+	_lines_edited(p_from_line, p_to_line);
+
+	if (highlighting_cache.is_empty()) {
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = MIN(p_from_line, p_to_line) - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
-			highlighting_cache.erase(i);
+	_shift_line_cache(highlighting_cache, p_from_line, p_to_line);
+
+	// Edited lines are highlighted again, the lines after them only if the state they depend on changed.
+	const int edited_from = MAX(0, MIN(p_from_line, p_to_line) - 1);
+	const int edited_to = MIN(p_from_line, p_to_line) + MAX(0, p_to_line - p_from_line);
+	for (int i = edited_from; i < (int)highlighting_cache.size(); i++) {
+		if (i <= edited_to) {
+			highlighting_cache[i].valid = false;
+			highlighting_cache[i].color_map = Dictionary();
+		} else {
+			highlighting_cache[i].stale = true;
 		}
 	}
 }
@@ -130,28 +158,18 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 	Color keyword_color;
 	Color color;
 
-	color_region_cache[p_line] = -1;
-	int in_region = -1;
-	if (p_line != 0) {
-		int prev_region_line = p_line - 1;
-		while (prev_region_line > 0 && !color_region_cache.has(prev_region_line)) {
-			prev_region_line--;
-		}
-		for (int i = prev_region_line; i < p_line - 1; i++) {
-			get_line_syntax_highlighting(i);
-		}
-		if (!color_region_cache.has(p_line - 1)) {
-			get_line_syntax_highlighting(p_line - 1);
-		}
-		in_region = color_region_cache[p_line - 1];
+	int in_region = _get_line_start_region(p_line);
+	if (p_line >= (int)color_region_cache.size()) {
+		color_region_cache.resize(p_line + 1);
 	}
+	color_region_cache[p_line] = Vector2i(in_region, -1);
 
 	const String &str = text_edit->get_line(p_line);
 	const int line_length = str.length();
 	Color prev_color;
 
 	if (in_region != -1 && str.length() == 0) {
-		color_region_cache[p_line] = in_region;
+		color_region_cache[p_line].y = in_region;
 	}
 	for (int j = 0; j < line_length; j++) {
 		Dictionary highlighter_info;
@@ -216,7 +234,7 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 
 							j = line_length;
 							if (!color_regions[c].line_only) {
-								color_region_cache[p_line] = c;
+								color_region_cache[p_line].y = c;
 							}
 						}
 						break;
@@ -285,7 +303,7 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 
 					j = from + (end_key_length - 1);
 					if (region_end_index == -1) {
-						color_region_cache[p_line] = in_region;
+						color_region_cache[p_line].y = in_region;
 					}
 
 					in_region = -1;
@@ -415,6 +433,31 @@ Dictionary CodeHighlighter::_get_line_syntax_highlighting_impl(int p_line) {
 	return color_map;
 }
 
+int CodeHighlighter::_get_line_start_region(int p_line) {
+	if (p_line <= 0) {
+		return -1;
+	}
+
+	// Catch up from the closest line with up to date highlighting, instead of recursing through every previous line.
+	int prev_region_line = p_line - 1;
+	while (prev_region_line > 0 && !_is_line_cached(prev_region_line)) {
+		prev_region_line--;
+	}
+	for (int i = prev_region_line; i < p_line; i++) {
+		get_line_syntax_highlighting(i);
+	}
+	return p_line - 1 < (int)color_region_cache.size() ? color_region_cache[p_line - 1].y : -1;
+}
+
+bool CodeHighlighter::_is_stale_line_valid(int p_line) {
+	// Once a line after an edit starts in the same region as before, the state has converged.
+	return p_line < (int)color_region_cache.size() && color_region_cache[p_line].x == _get_line_start_region(p_line);
+}
+
+void CodeHighlighter::_lines_edited(int p_from_line, int p_to_line) {
+	_shift_line_cache(color_region_cache, p_from_line, p_to_line);
+}
+
 void CodeHighlighter::_clear_highlighting_cache() {
 	color_region_cache.clear();
 }
@@ -34,6 +34,7 @@
 
 #include "core/io/resource.h"
 #include "core/object/gdvirtual.gen.inc"
+#include "core/templates/local_vector.h"
 
 class TextEdit;
 
@@ -41,7 +42,12 @@ class SyntaxHighlighter : public Resource {
 	GDCLASS(SyntaxHighlighter, Resource)
 
 private:
-	RBMap<int, Dictionary> highlighting_cache;
+	struct CachedLine {
+		Dictionary color_map;
+		bool valid = false;
+		bool stale = false; // Highlighted before an edit on a previous line.
+	};
+	LocalVector<CachedLine> highlighting_cache;
 	void _lines_edited_from(int p_from_line, int p_to_line);
 
 protected:
@@ -50,6 +56,36 @@ protected:
 
 	static void _bind_methods();
 
+	// Keeps a per-line cache aligned with the text after lines were inserted or removed.
+	template <class T>
+	static void _shift_line_cache(LocalVector<T> &r_cache, int p_from_line, int p_to_line) {
+		const int at = MIN(p_from_line, p_to_line) + 1;
+		const int delta = p_to_line - p_from_line;
+		const int size = r_cache.size();
+		if (delta == 0 || at >= size) {
+			return;
+		}
+
+		if (delta > 0) {
+			r_cache.resize(size + delta);
+			for (int i = size - 1; i >= at; i--) {
+				r_cache[i + delta] = r_cache[i];
+			}
+		} else {
+			const int removed = MIN(-delta, size - at);
+			for (int i = at + removed; i < size; i++) {
+				r_cache[i - removed] = r_cache[i];
+			}
+			r_cache.resize(size - removed);
+		}
+	}
+
+	bool _is_line_cached(int p_line) const;
+
+	// Lines after an edit keep their highlighting, which is reused if this confirms the state they were highlighted with didn't change.
+	virtual bool _is_stale_line_valid(int p_line) { return false; }
+	virtual void _lines_edited(int p_from_line, int p_to_line) {}
+
 	GDVIRTUAL1RC(Dictionary, _get_line_syntax_highlighting, int)
 	GDVIRTUAL0(_clear_highlighting_cache)
 	GDVIRTUAL0(_update_cache)
@@ -83,7 +119,8 @@ private:
 		bool line_only = false;
 	};
 	Vector<ColorRegion> color_regions;
-	HashMap<int, int> color_region_cache;
+	LocalVector<Vector2i> color_region_cache; // Region each highlighted line starts (x) and ends (y) in, -1 for none.
+	int _get_line_start_region(int p_line);
 
 	Dictionary keywords;
 	Dictionary member_keywords;
@@ -97,6 +134,9 @@ private:
 protected:
 	static void _bind_methods();
 
+	virtual bool _is_stale_line_valid(int p_line) override;
+	virtual void _lines_edited(int p_from_line, int p_to_line) override;
+
 public:
 	virtual Dictionary _get_line_syntax_highlighting_impl(int p_line) override;
 
@@ -33,6 +33,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/resource_loader.h"
+#include "core/os/thread.h"
 #include "scene/gui/control.h"
 #include "scene/main/node.h"
 #include "scene/main/window.h"
@@ -140,6 +141,7 @@ void ThemeDB::set_fallback_base_scale(float p_base_scale) {
 	}
 
 	fallback_base_scale = p_base_scale;
+	_clear_theme_context_caches();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -153,6 +155,7 @@ void ThemeDB::set_fallback_font(const Ref<Font> &p_font) {
 	}
 
 	fallback_font = p_font;
+	_clear_theme_context_caches();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -166,6 +169,7 @@ void ThemeDB::set_fallback_font_size(int p_font_size) {
 	}
 
 	fallback_font_size = p_font_size;
+	_clear_theme_context_caches();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -179,6 +183,7 @@ void ThemeDB::set_fallback_icon(const Ref<Texture2D> &p_icon) {
 	}
 
 	fallback_icon = p_icon;
+	_clear_theme_context_caches();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -192,6 +197,7 @@ void ThemeDB::set_fallback_stylebox(const Ref<StyleBox> &p_stylebox) {
 	}
 
 	fallback_stylebox = p_stylebox;
+	_clear_theme_context_caches();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -268,6 +274,16 @@ void ThemeDB::_propagate_theme_context(Node *p_from_node, ThemeContext *p_contex
 	}
 }
 
+void ThemeDB::_clear_theme_context_caches() {
+	// Fallback values are returned for missing items, so resolved items may refer to them.
+	if (default_theme_context) {
+		default_theme_context->_clear_item_cache();
+	}
+	for (const KeyValue<Node *, ThemeContext *> &E : theme_contexts) {
+		E.value->_clear_item_cache();
+	}
+}
+
 void ThemeDB::_init_default_theme_context() {
 	default_theme_context = memnew(ThemeContext);
 
@@ -455,7 +471,79 @@ ThemeDB::~ThemeDB() {
 	singleton = nullptr;
 }
 
+uint32_t ThemeContext::_hash_theme_item(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) {
+	uint32_t hash = hash_murmur3_one_32(p_data_type);
+	hash = hash_murmur3_one_32(p_name.hash(), hash);
+	for (const StringName &E : p_theme_types) {
+		hash = hash_murmur3_one_32(E.hash(), hash);
+	}
+	return hash_fmix32(hash);
+}
+
+bool ThemeContext::CachedThemeItem::matches(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const {
+	if (data_type != p_data_type || name != p_name || theme_types.size() != (uint32_t)p_theme_types.size()) {
+		return false;
+	}
+
+	uint32_t i = 0;
+	for (const StringName &E : p_theme_types) {
+		if (theme_types[i++] != E) {
+			return false;
+		}
+	}
+	return true;
+}
+
+ThemeContext::ResolvedThemeItem ThemeContext::_find_theme_item(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const {
+	ResolvedThemeItem item;
+	for (const Ref<Theme> &theme : themes) {
+		for (const StringName &type : p_theme_types) {
+			if (theme->has_theme_item(p_data_type, p_name, type)) {
+				item.value = theme->get_theme_item(p_data_type, p_name, type);
+				item.found = true;
+				return item;
+			}
+		}
+	}
+
+	// If no match exists, use any type to return the default/empty value.
+	item.value = get_fallback_theme()->get_theme_item(p_data_type, p_name, StringName());
+	return item;
+}
+
+ThemeContext::ResolvedThemeItem ThemeContext::_resolve_theme_item(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const {
+	// Controls in sub-thread process groups resolve their items without the cache.
+	if (!Thread::is_main_thread()) {
+		return _find_theme_item(p_data_type, p_name, p_theme_types);
+	}
+
+	const uint32_t hash = _hash_theme_item(p_data_type, p_name, p_theme_types);
+	const CachedThemeItem *cached = item_cache.getptr(hash);
+	if (cached) {
+		if (cached->matches(p_data_type, p_name, p_theme_types)) {
+			return cached->item;
+		}
+		// Another item with the same hash, too rare to be worth chaining.
+		return _find_theme_item(p_data_type, p_name, p_theme_types);
+	}
+
+	CachedThemeItem entry;
+	entry.data_type = p_data_type;
+	entry.name = p_name;
+	entry.theme_types.reserve(p_theme_types.size());
+	for (const StringName &E : p_theme_types) {
+		entry.theme_types.push_back(E);
+	}
+	entry.item = _find_theme_item(p_data_type, p_name, p_theme_types);
+	return item_cache.insert(hash, entry)->value.item;
+}
+
+void ThemeContext::_clear_item_cache() {
+	item_cache.clear();
+}
+
 void ThemeContext::_emit_changed() {
+	_clear_item_cache();
 	emit_signal(CoreStringName(changed));
 }
 
@@ -491,6 +579,14 @@ Ref<Theme> ThemeContext::get_fallback_theme() const {
 	return themes.back()->get();
 }
 
+Variant ThemeContext::get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const {
+	return _resolve_theme_item(p_data_type, p_name, p_theme_types).value;
+}
+
+bool ThemeContext::has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const {
+	return _resolve_theme_item(p_data_type, p_name, p_theme_types).found;
+}
+
 void ThemeContext::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("changed"));
 }
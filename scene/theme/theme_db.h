@@ -34,6 +34,7 @@
 
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "scene/resources/theme.h"
 
 #include <functional>
@@ -92,6 +93,7 @@ class ThemeDB : public Object {
 	HashMap<Node *, ThemeContext *> theme_contexts;
 
 	void _propagate_theme_context(Node *p_from_node, ThemeContext *p_context);
+	void _clear_theme_context_caches();
 	void _init_default_theme_context();
 	void _finalize_theme_contexts();
 
@@ -185,6 +187,30 @@ class ThemeContext : public Object {
 	// and the last theme is the fallback theme where every lookup ends.
 	List<Ref<Theme>> themes;
 
+	// Theme items resolved through the themes of this context. They are shared by all
+	// nodes using the context, so each item is only looked up once per theme change.
+	struct ResolvedThemeItem {
+		Variant value;
+		bool found = false;
+	};
+
+	struct CachedThemeItem {
+		Theme::DataType data_type = Theme::DATA_TYPE_MAX;
+		StringName name;
+		LocalVector<StringName> theme_types;
+		ResolvedThemeItem item;
+
+		bool matches(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const;
+	};
+
+	// Keyed by the hash of the data type, name and theme types, so lookups don't copy the types.
+	// Only used on the main thread, so it doesn't need to be locked.
+	mutable HashMap<uint32_t, CachedThemeItem> item_cache;
+
+	static uint32_t _hash_theme_item(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types);
+	ResolvedThemeItem _find_theme_item(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const;
+	ResolvedThemeItem _resolve_theme_item(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const;
+	void _clear_item_cache();
 	void _emit_changed();
 
 protected:
@@ -194,6 +220,9 @@ public:
 	void set_themes(List<Ref<Theme>> &p_themes);
 	List<Ref<Theme>> get_themes() const;
 	Ref<Theme> get_fallback_theme() const;
+
+	Variant get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const;
+	bool has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) const;
 };
 
 #endif // THEME_DB_H
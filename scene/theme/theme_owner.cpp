@@ -250,7 +250,7 @@ void ThemeOwner::get_theme_type_dependencies(const Node *p_for_node, const Strin
 	ThemeDB::get_singleton()->get_native_type_dependencies(p_theme_type, r_list);
 }
 
-Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
+Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) {
 	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, Variant(), "At least one theme type must be specified.");
 
 	// First, look through each control or window node in the branch, until no valid parent can be found.
@@ -259,34 +259,24 @@ Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const S
 
 	while (owner_node) {
 		// For each theme resource check the theme types provided and see if p_name exists with any of them.
-		for (const StringName &E : p_theme_types) {
-			Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
-
-			if (owner_theme.is_valid() && owner_theme->has_theme_item(p_data_type, p_name, E)) {
-				return owner_theme->get_theme_item(p_data_type, p_name, E);
-			}
-		}
-
-		owner_node = _get_next_owner_node(owner_node);
-	}
-
-	// Second, check global themes from the appropriate context.
-	ThemeContext *global_context = _get_active_owner_context();
-	for (const Ref<Theme> &theme : global_context->get_themes()) {
-		if (theme.is_valid()) {
+		Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
+		if (owner_theme.is_valid()) {
 			for (const StringName &E : p_theme_types) {
-				if (theme->has_theme_item(p_data_type, p_name, E)) {
-					return theme->get_theme_item(p_data_type, p_name, E);
+				if (owner_theme->has_theme_item(p_data_type, p_name, E)) {
+					return owner_theme->get_theme_item(p_data_type, p_name, E);
 				}
 			}
 		}
+
+		owner_node = _get_next_owner_node(owner_node);
 	}
 
-	// Finally, if no match exists, use any type to return the default/empty value.
-	return global_context->get_fallback_theme()->get_theme_item(p_data_type, p_name, StringName());
+	// Second, check global themes from the appropriate context. The context resolves each item once,
+	// and falls back to the default/empty value if no match exists.
+	return _get_active_owner_context()->get_theme_item_in_types(p_data_type, p_name, p_theme_types);
 }
 
-bool ThemeOwner::has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
+bool ThemeOwner::has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types) {
 	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, false, "At least one theme type must be specified.");
 
 	// First, look through each control or window node in the branch, until no valid parent can be found.
@@ -295,31 +285,20 @@ bool ThemeOwner::has_theme_item_in_types(Theme::DataType p_data_type, const Stri
 
 	while (owner_node) {
 		// For each theme resource check the theme types provided and see if p_name exists with any of them.
-		for (const StringName &E : p_theme_types) {
-			Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
-
-			if (owner_theme.is_valid() && owner_theme->has_theme_item(p_data_type, p_name, E)) {
-				return true;
-			}
-		}
-
-		owner_node = _get_next_owner_node(owner_node);
-	}
-
-	// Second, check global themes from the appropriate context.
-	ThemeContext *global_context = _get_active_owner_context();
-	for (const Ref<Theme> &theme : global_context->get_themes()) {
-		if (theme.is_valid()) {
+		Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
+		if (owner_theme.is_valid()) {
 			for (const StringName &E : p_theme_types) {
-				if (theme->has_theme_item(p_data_type, p_name, E)) {
+				if (owner_theme->has_theme_item(p_data_type, p_name, E)) {
 					return true;
 				}
 			}
 		}
+
+		owner_node = _get_next_owner_node(owner_node);
 	}
 
-	// Finally, if no match exists, return false.
-	return false;
+	// Second, check global themes from the appropriate context.
+	return _get_active_owner_context()->has_theme_item_in_types(p_data_type, p_name, p_theme_types);
 }
 
 float ThemeOwner::get_theme_default_base_scale() {
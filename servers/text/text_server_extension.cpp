@@ -219,6 +219,10 @@ void TextServerExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_font_get_global_oversampling);
 	GDVIRTUAL_BIND(_font_set_global_oversampling, "oversampling");
 
+	GDVIRTUAL_BIND(_font_get_global_glyph_cache_memory);
+	GDVIRTUAL_BIND(_font_get_global_glyph_cache_eviction_count);
+	GDVIRTUAL_BIND(_font_trim_global_glyph_cache, "max_memory");
+
 	GDVIRTUAL_BIND(_get_hex_code_box_size, "size", "index");
 	GDVIRTUAL_BIND(_draw_hex_code_box, "canvas", "size", "pos", "index", "color");
 
@@ -991,6 +995,24 @@ void TextServerExtension::font_set_global_oversampling(double p_oversampling) {
 	GDVIRTUAL_CALL(_font_set_global_oversampling, p_oversampling);
 }
 
+int64_t TextServerExtension::font_get_global_glyph_cache_memory() const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_font_get_global_glyph_cache_memory, ret);
+	return ret;
+}
+
+int64_t TextServerExtension::font_get_global_glyph_cache_eviction_count() const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_font_get_global_glyph_cache_eviction_count, ret);
+	return ret;
+}
+
+TypedArray<RID> TextServerExtension::font_trim_global_glyph_cache(int64_t p_max_memory) {
+	TypedArray<RID> ret;
+	GDVIRTUAL_CALL(_font_trim_global_glyph_cache, p_max_memory, ret);
+	return ret;
+}
+
 Vector2 TextServerExtension::get_hex_code_box_size(int64_t p_size, int64_t p_index) const {
 	Vector2 ret;
 	if (GDVIRTUAL_CALL(_get_hex_code_box_size, p_size, p_index, ret)) {
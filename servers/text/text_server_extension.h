@@ -364,6 +364,13 @@ public:
 	GDVIRTUAL0RC(double, _font_get_global_oversampling);
 	GDVIRTUAL1(_font_set_global_oversampling, double);
 
+	virtual int64_t font_get_global_glyph_cache_memory() const override;
+	virtual int64_t font_get_global_glyph_cache_eviction_count() const override;
+	virtual TypedArray<RID> font_trim_global_glyph_cache(int64_t p_max_memory) override;
+	GDVIRTUAL0RC(int64_t, _font_get_global_glyph_cache_memory);
+	GDVIRTUAL0RC(int64_t, _font_get_global_glyph_cache_eviction_count);
+	GDVIRTUAL1R(TypedArray<RID>, _font_trim_global_glyph_cache, int64_t);
+
 	virtual Vector2 get_hex_code_box_size(int64_t p_size, int64_t p_index) const override;
 	virtual void draw_hex_code_box(const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const override;
 	GDVIRTUAL2RC(Vector2, _get_hex_code_box_size, int64_t, int64_t);
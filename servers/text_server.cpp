@@ -373,6 +373,10 @@ void TextServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("font_get_global_oversampling"), &TextServer::font_get_global_oversampling);
 	ClassDB::bind_method(D_METHOD("font_set_global_oversampling", "oversampling"), &TextServer::font_set_global_oversampling);
 
+	ClassDB::bind_method(D_METHOD("font_get_global_glyph_cache_memory"), &TextServer::font_get_global_glyph_cache_memory);
+	ClassDB::bind_method(D_METHOD("font_get_global_glyph_cache_eviction_count"), &TextServer::font_get_global_glyph_cache_eviction_count);
+	ClassDB::bind_method(D_METHOD("font_trim_global_glyph_cache", "max_memory"), &TextServer::font_trim_global_glyph_cache);
+
 	ClassDB::bind_method(D_METHOD("get_hex_code_box_size", "size", "index"), &TextServer::get_hex_code_box_size);
 	ClassDB::bind_method(D_METHOD("draw_hex_code_box", "canvas", "size", "pos", "index", "color"), &TextServer::draw_hex_code_box);
 
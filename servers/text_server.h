@@ -410,6 +410,10 @@ public:
 	virtual double font_get_global_oversampling() const = 0;
 	virtual void font_set_global_oversampling(double p_oversampling) = 0;
 
+	virtual int64_t font_get_global_glyph_cache_memory() const = 0;
+	virtual int64_t font_get_global_glyph_cache_eviction_count() const = 0;
+	virtual TypedArray<RID> font_trim_global_glyph_cache(int64_t p_max_memory) = 0;
+
 	virtual Vector2 get_hex_code_box_size(int64_t p_size, int64_t p_index) const;
 	virtual void draw_hex_code_box(const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const;
 
@@ -33,6 +33,8 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -108,6 +110,97 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Compressed files with read-ahead") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("file_access_compressed.bin");
+	PackedByteArray data;
+	uint32_t seed = 42;
+	for (int i = 0; i < 100000; i++) {
+		seed = seed * 1103515245 + 12345;
+		data.push_back((i % 7 == 0) ? (seed >> 24) : (i & 0x3f));
+	}
+
+	{
+		// Written with several blocks, compressed in parallel.
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("TEST");
+		REQUIRE(fac->open_internal(path, FileAccess::WRITE) == OK);
+		fac->store_buffer(data.ptr(), data.size());
+	}
+
+	// Without read-ahead, with spans of two blocks, and with spans of eight blocks (the last one partial).
+	for (int read_ahead : { 0, 4, 16 }) {
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("TEST");
+		REQUIRE(fac->open_internal(path, FileAccess::READ) == OK);
+		fac->set_read_ahead(read_ahead);
+		Ref<FileAccess> f = fac;
+		CHECK(f->get_length() == (uint64_t)data.size());
+
+		// Sequential reads, across block boundaries.
+		PackedByteArray read = f->get_buffer(10000);
+		read.append_array(f->get_buffer(90000));
+		CHECK(read == data);
+		CHECK_FALSE(f->eof_reached());
+		CHECK(f->get_buffer(1).is_empty());
+		CHECK(f->eof_reached());
+
+		// Random access, the read-ahead blocks are discarded.
+		f->seek(50000);
+		CHECK(f->get_8() == data[50000]);
+		f->seek(4095);
+		CHECK(f->get_buffer(2) == data.slice(4095, 4097));
+		CHECK(f->get_position() == 4097);
+		f->seek(90000);
+		fac->set_read_ahead(0);
+		CHECK(f->get_buffer(20000) == data.slice(90000));
+		CHECK(f->eof_reached());
+	}
+}
+
+TEST_CASE("[FileAccess] Asynchronous reads") {
+	const String path = OS::get_singleton()->get_cache_path().path_join("file_access_async.bin");
+	PackedByteArray data;
+	for (int i = 0; i < 200000; i++) {
+		data.push_back(i * 7 + (i >> 8));
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(data);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(1000);
+
+	// Several reads in flight while the file is read synchronously.
+	FileAccess::AsyncReadID whole = f->read_async(0, data.size());
+	FileAccess::AsyncReadID middle = f->read_async(123456, 5000);
+	FileAccess::AsyncReadID past_end = f->read_async(data.size() - 100, 1000);
+	CHECK(f->get_buffer(100) == data.slice(1000, 1100));
+
+	PackedByteArray read;
+	CHECK(f->wait_for_async_read(middle, read) == OK);
+	CHECK(read == data.slice(123456, 128456));
+	CHECK(f->wait_for_async_read(past_end, read) == ERR_FILE_EOF);
+	CHECK(read == data.slice(data.size() - 100));
+	CHECK(f->wait_for_async_read(whole, read) == OK);
+	CHECK(read == data);
+
+	// The file position isn't moved by asynchronous reads.
+	CHECK(f->get_position() == 1100);
+
+	ERR_PRINT_OFF;
+	CHECK(f->wait_for_async_read(whole, read) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+
+	// Reads still pending when the file is closed are waited for.
+	f->read_async(0, data.size());
+	f->close();
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
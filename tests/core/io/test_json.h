@@ -233,6 +233,63 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+TEST_CASE("[JSON] Parsing and stringifying UTF-8 buffers") {
+	const String json_string = U"{\"name\": \"Noël 天地 \\u00e9\\ud83c\\udfa4\", \"values\": [1, -2.5, 3e2, true, null], \"nested\": {\"empty\": []}}";
+	const CharString json_utf8 = json_string.utf8();
+
+	JSON json_utf32;
+	CHECK(json_utf32.parse(json_string) == OK);
+
+	JSON json;
+	CHECK(json.parse_utf8((const uint8_t *)json_utf8.get_data(), json_utf8.length()) == OK);
+	CHECK_MESSAGE(
+			json.get_data() == json_utf32.get_data(),
+			"Parsing UTF-8 text should give the same result as parsing the equivalent String.");
+	Dictionary dict = json.get_data();
+	CHECK(dict["name"] == U"Noël 天地 é🎤");
+
+	// Byte order mark.
+	PackedByteArray buffer;
+	buffer.push_back(0xef);
+	buffer.push_back(0xbb);
+	buffer.push_back(0xbf);
+	for (int i = 0; i < json_utf8.length(); i++) {
+		buffer.push_back(json_utf8[i]);
+	}
+	CHECK(json.parse_utf8_buffer(buffer) == OK);
+	CHECK(json.get_data() == json_utf32.get_data());
+
+	// Interned keys share their data, and are looked up as usual.
+	const CharString records = String("[{\"id\": 1, \"name\": \"a\"}, {\"id\": 2, \"name\": \"b\"}]").utf8();
+	CHECK(json.parse_utf8((const uint8_t *)records.get_data(), records.length(), false, true) == OK);
+	Array array = json.get_data();
+	REQUIRE(array.size() == 2);
+	Dictionary first = array[0];
+	Dictionary second = array[1];
+	CHECK(second["name"] == "b");
+	CHECK(String(first.get_key_at_index(0)).ptr() == String(second.get_key_at_index(0)).ptr());
+	CHECK(String(first.get_key_at_index(1)).ptr() == String(second.get_key_at_index(1)).ptr());
+
+	CHECK(json.parse_utf8((const uint8_t *)records.get_data(), records.length()) == OK);
+	array = json.get_data();
+	first = array[0];
+	second = array[1];
+	CHECK(String(first.get_key_at_index(0)).ptr() != String(second.get_key_at_index(0)).ptr());
+
+	// The buffer is not NUL terminated, parsing must stop at its end.
+	ERR_PRINT_OFF
+	CHECK(json.parse_utf8((const uint8_t *)json_utf8.get_data(), json_utf8.length() - 1) == ERR_PARSE_ERROR);
+	ERR_PRINT_ON
+
+	// Stringify produces the same text as a String and as UTF-8.
+	const Variant data = json_utf32.get_data();
+	const String text = JSON::stringify(data, "\t");
+	const PackedByteArray text_utf8 = JSON::stringify_utf8_buffer(data, "\t");
+	CHECK(String::utf8((const char *)text_utf8.ptr(), text_utf8.size()) == text);
+	CHECK(json.parse_utf8_buffer(text_utf8) == OK);
+	CHECK(json.get_data() == data);
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -327,6 +327,57 @@ TEST_CASE("[Marshalls] FLOAT double precision Variant decoding") {
 	CHECK(r_len == 12);
 	CHECK(variant == Variant(0.33333333333333333));
 }
+
+TEST_CASE("[Marshalls] PACKED_FLOAT32_ARRAY Variant decoding") {
+	Variant variant;
+	int r_len;
+	uint8_t buffer[] = {
+		Variant::PACKED_FLOAT32_ARRAY, 0x00, 0x00, 0x00, // Variant::PACKED_FLOAT32_ARRAY
+		0x02, 0x00, 0x00, 0x00, // count
+		0x00, 0x00, 0x20, 0x3e, // 0.15625
+		0x00, 0x00, 0x80, 0xbf // -1.0
+	};
+
+	CHECK(decode_variant(variant, buffer, 16, &r_len) == OK);
+	CHECK(r_len == 16);
+	CHECK(variant == Variant(PackedFloat32Array({ 0.15625f, -1.0f })));
+}
+
+TEST_CASE("[Marshalls] Large packed arrays encoding and decoding") {
+	PackedByteArray bytes;
+	PackedInt32Array ints;
+	PackedInt64Array longs;
+	PackedFloat32Array floats;
+	PackedFloat64Array doubles;
+	PackedVector2Array vectors2;
+	PackedVector3Array vectors3;
+	PackedColorArray colors;
+	for (int i = 0; i < 1000; i++) {
+		bytes.push_back(i * 7);
+		ints.push_back(i * -13);
+		longs.push_back(int64_t(i) << 33);
+		floats.push_back(i * 0.5f);
+		doubles.push_back(i / 3.0);
+		vectors2.push_back(Vector2(i, -i * 0.25));
+		vectors3.push_back(Vector3(i, i * 2, -i));
+		colors.push_back(Color(i / 1000.0, 0.5, 1, 0.25));
+	}
+	const Variant arrays[] = { bytes, ints, longs, floats, doubles, vectors2, vectors3, colors };
+
+	for (const Variant &array : arrays) {
+		int len = 0;
+		REQUIRE(encode_variant(array, nullptr, len) == OK);
+		Vector<uint8_t> buffer;
+		buffer.resize(len);
+		REQUIRE(encode_variant(array, buffer.ptrw(), len) == OK);
+
+		Variant variant;
+		int r_len = 0;
+		CHECK(decode_variant(variant, buffer.ptr(), buffer.size(), &r_len) == OK);
+		CHECK(r_len == len);
+		CHECK_MESSAGE(variant == array, "Should decode back to the same array.");
+	}
+}
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
@@ -33,6 +33,7 @@
 #define TEST_PCK_PACKER_H
 
 #include "core/io/file_access_pack.h"
+#include "core/io/marshalls.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
 
@@ -118,6 +119,113 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack and load compressed files") {
+	// Compressible text with an incompressible tail, spanning several compression blocks.
+	const String source_path = OS::get_singleton()->get_cache_path().path_join("pck_packer_source.txt");
+	PackedByteArray source;
+	const CharString line = String("[node name=\"Sprite2D\" type=\"Sprite2D\" parent=\".\"]\nposition = Vector2(12, 34)\n").utf8();
+	while (source.size() < 300000) {
+		for (int i = 0; i < line.length(); i++) {
+			source.push_back(line[i]);
+		}
+	}
+	uint32_t seed = 1234;
+	for (int i = 0; i < 70000; i++) {
+		seed = seed * 1103515245 + 12345;
+		source.push_back(seed >> 24);
+	}
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(source);
+	}
+
+	const String plain_pck_path = OS::get_singleton()->get_cache_path().path_join("output_plain.pck");
+	const String compressed_pck_path = OS::get_singleton()->get_cache_path().path_join("output_compressed.pck");
+	for (int i = 0; i < 2; i++) {
+		const bool compress = i == 1;
+		PCKPacker pck_packer;
+		CHECK(pck_packer.pck_start(compress ? compressed_pck_path : plain_pck_path) == OK);
+		CHECK(pck_packer.add_file(vformat("res://pck_packer_test_%d/source.txt", i), source_path, false, compress) == OK);
+		CHECK(pck_packer.add_file(vformat("res://pck_packer_test_%d/encrypted.txt", i), source_path, true, compress) == OK);
+		CHECK(pck_packer.flush() == OK);
+	}
+
+	const uint64_t plain_size = FileAccess::open(plain_pck_path, FileAccess::READ)->get_length();
+	const uint64_t compressed_size = FileAccess::open(compressed_pck_path, FileAccess::READ)->get_length();
+	CHECK_MESSAGE(
+			compressed_size < plain_size * 2 / 3,
+			"The PCK with compressed files should be smaller than the PCK with stored files.");
+
+	REQUIRE(PackedData::get_singleton()->add_pack(plain_pck_path, true, 0) == OK);
+	REQUIRE(PackedData::get_singleton()->add_pack(compressed_pck_path, true, 0) == OK);
+
+	for (int i = 0; i < 2; i++) {
+		CHECK(FileAccess::get_file_as_bytes(vformat("res://pck_packer_test_%d/source.txt", i)) == source);
+		CHECK(FileAccess::get_file_as_bytes(vformat("res://pck_packer_test_%d/encrypted.txt", i)) == source);
+	}
+
+	// Random access across block boundaries.
+	Ref<FileAccess> f = FileAccess::open("res://pck_packer_test_1/source.txt", FileAccess::READ);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == (uint64_t)source.size());
+	const uint64_t positions[] = { 65530, 0, 131000, 299990, 369000, 12345 };
+	for (const uint64_t position : positions) {
+		f->seek(position);
+		PackedByteArray read = f->get_buffer(100);
+		CHECK(read == source.slice(position, position + 100));
+		CHECK(f->get_position() == MIN(position + 100, (uint64_t)source.size()));
+	}
+	f->seek(65535);
+	CHECK(f->get_8() == source[65535]);
+	CHECK(f->get_8() == source[65536]);
+	CHECK_FALSE(f->eof_reached());
+	f->seek_end();
+	CHECK(f->get_8() == 0);
+	CHECK(f->eof_reached());
+	f.unref();
+
+	// Don't leave the packs mounted for other tests.
+	PackedData::get_singleton()->remove_pack(plain_pck_path);
+	PackedData::get_singleton()->remove_pack(compressed_pck_path);
+	CHECK_FALSE(PackedData::get_singleton()->has_path("res://pck_packer_test_0/source.txt"));
+	CHECK_FALSE(PackedData::get_singleton()->has_directory("res://pck_packer_test_1"));
+
+	// Corrupted seek tables fail to open instead of reading past the file data.
+	const PackedByteArray pck = FileAccess::get_file_as_bytes(compressed_pck_path);
+	const uint8_t table_start[] = { 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00 }; // Block size and count of source.txt.
+	int64_t table_ofs = -1;
+	for (int64_t i = 0; i + 8 <= pck.size() && table_ofs == -1; i++) {
+		if (memcmp(pck.ptr() + i, table_start, 8) == 0) {
+			table_ofs = i;
+		}
+	}
+	REQUIRE(table_ofs != -1);
+
+	const String corrupted_pck_path = OS::get_singleton()->get_cache_path().path_join("output_corrupted.pck");
+	const uint64_t corrupted_ofs[] = { 0, 0, 8 };
+	const uint32_t corrupted_values[] = { 1024, 64 * 1024 * 1024, 0x7fffffff };
+	for (int i = 0; i < 3; i++) {
+		PackedByteArray corrupted = pck;
+		encode_uint32(corrupted_values[i], corrupted.ptrw() + table_ofs + corrupted_ofs[i]);
+		{
+			Ref<FileAccess> cf = FileAccess::open(corrupted_pck_path, FileAccess::WRITE);
+			REQUIRE(cf.is_valid());
+			cf->store_buffer(corrupted);
+		}
+		REQUIRE(PackedData::get_singleton()->add_pack(corrupted_pck_path, true, 0) == OK);
+
+		ERR_PRINT_OFF;
+		Ref<FileAccess> cf = FileAccess::open("res://pck_packer_test_1/source.txt", FileAccess::READ);
+		ERR_PRINT_ON;
+		CHECK_MESSAGE(
+				(cf.is_null() || !cf->is_open()),
+				"A compressed file with a corrupted seek table should fail to open.");
+
+		PackedData::get_singleton()->remove_pack(corrupted_pck_path);
+	}
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
@@ -32,9 +32,12 @@
 #ifndef TEST_RESOURCE_H
 #define TEST_RESOURCE_H
 
+#include "core/io/file_access.h"
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
@@ -111,6 +114,132 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Saving and loading many sub-resources") {
+	// Enough sub-resources for the binary loader to decode them on several threads.
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	Ref<Resource> previous;
+	for (int i = 0; i < 300; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		child->set_meta("values", PackedInt32Array({ i, i * 2, i * 3 }));
+		if (previous.is_valid()) {
+			child->set_meta("previous", previous);
+		}
+		children.push_back(child);
+		previous = child;
+	}
+	resource->set_meta("children", children);
+
+	// Compressed files can't be read in the background, they must be decoded in parallel too.
+	for (const uint32_t flags : { (uint32_t)ResourceSaver::FLAG_NONE, (uint32_t)ResourceSaver::FLAG_COMPRESS }) {
+		const String save_path_binary = OS::get_singleton()->get_cache_path().path_join(vformat("resource_many_%d.res", flags));
+		CHECK(ResourceSaver::save(resource, save_path_binary, flags) == OK);
+
+		const uint32_t threaded_decode_count = ResourceLoaderBinary::get_threaded_decode_count();
+		const Ref<Resource> loaded_resource = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+		REQUIRE(loaded_resource.is_valid());
+		if (WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+			CHECK_MESSAGE(ResourceLoaderBinary::get_threaded_decode_count() == threaded_decode_count + 1, "Sub-resources should be decoded in parallel.");
+		}
+
+		const Array loaded_children = loaded_resource->get_meta("children");
+		REQUIRE(loaded_children.size() == 300);
+		for (int i = 0; i < loaded_children.size(); i++) {
+			const Ref<Resource> child = loaded_children[i];
+			CHECK(child->get_name() == vformat("Child %d", i));
+			CHECK(child->get_meta("values") == PackedInt32Array({ i, i * 2, i * 3 }));
+			if (i > 0) {
+				CHECK_MESSAGE(
+						Ref<Resource>(child->get_meta("previous")) == Ref<Resource>(loaded_children[i - 1]),
+						"Sub-resources should be linked to the same loaded instances.");
+			}
+		}
+	}
+}
+
+TEST_CASE("[Resource] Saving incrementally") {
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	for (int i = 0; i < 30; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		PackedFloat32Array values;
+		values.resize(100);
+		values.fill(i);
+		child->set_meta("values", values);
+		child->set_meta("scale", 0.0);
+		children.push_back(child);
+	}
+	resource->set_meta("children", children);
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_incremental.res");
+	ResourceFormatSaverBinary *saver = ResourceFormatSaverBinary::singleton;
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	CHECK(saver->get_incremental_reused_blocks(save_path) == 0);
+
+	// Only the changed sub-resources are encoded again, the root and the other children are copied.
+	Ref<Resource> changed = children[12];
+	changed->set_name("Changed");
+	changed->set_meta("values", PackedFloat32Array({ -1, -2 }));
+	Ref<Resource> negative_zero = children[7];
+	negative_zero->set_meta("scale", -0.0);
+
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	CHECK_MESSAGE(saver->get_incremental_reused_blocks(save_path) == 29, "Unchanged sub-resources and the root should be copied, and -0.0 should not be taken for 0.0.");
+	Vector<uint8_t> incremental_data = FileAccess::get_file_as_bytes(save_path);
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+	CHECK_MESSAGE(incremental_data == FileAccess::get_file_as_bytes(save_path), "Incremental saves should write the same data as full saves.");
+
+	// Adding a sub-resource changes the indices of the others, so they are all encoded again.
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	children.push_back(Ref<Resource>(memnew(Resource)));
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	CHECK(saver->get_incremental_reused_blocks(save_path) == 0);
+	incremental_data = FileAccess::get_file_as_bytes(save_path);
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+	CHECK_MESSAGE(incremental_data == FileAccess::get_file_as_bytes(save_path), "Incremental saves should write the same data as full saves.");
+
+	// Moving a property name after another one in the string table changes their indices, so all are encoded again.
+	Ref<Resource>(children[0])->set_meta("first", true);
+	Ref<Resource>(children[1])->set_meta("second", true);
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	Ref<Resource>(children[0])->remove_meta("first");
+	Ref<Resource>(children[2])->set_meta("first", true);
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	CHECK(saver->get_incremental_reused_blocks(save_path) == 0);
+	incremental_data = FileAccess::get_file_as_bytes(save_path);
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+	CHECK_MESSAGE(incremental_data == FileAccess::get_file_as_bytes(save_path), "Incremental saves should write the same data as full saves.");
+
+	const Ref<Resource> loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	const Array loaded_children = loaded_resource->get_meta("children");
+	REQUIRE(loaded_children.size() == 31);
+	const Ref<Resource> loaded_changed = loaded_children[12];
+	CHECK(loaded_changed->get_name() == "Changed");
+	CHECK(loaded_changed->get_meta("values") == PackedFloat32Array({ -1, -2 }));
+	const Ref<Resource> loaded_negative_zero = loaded_children[7];
+	CHECK(signbit(double(loaded_negative_zero->get_meta("scale"))));
+	const Ref<Resource> loaded_unchanged = loaded_children[13];
+	CHECK(loaded_unchanged->get_name() == "Child 13");
+	CHECK(PackedFloat32Array(loaded_unchanged->get_meta("values"))[99] == 13);
+	CHECK_FALSE(Ref<Resource>(loaded_children[0])->has_meta("first"));
+	CHECK(Ref<Resource>(loaded_children[2])->has_meta("first"));
+
+	// The kept data is freed with the resource.
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	CHECK(ResourceSaver::save(resource, save_path, ResourceSaver::FLAG_INCREMENTAL) == OK);
+	CHECK(saver->get_incremental_reused_blocks(save_path) == 32);
+	resource.unref();
+	children.clear();
+	changed.unref();
+	negative_zero.unref();
+	const String other_path = OS::get_singleton()->get_cache_path().path_join("resource_incremental_other.res");
+	CHECK(ResourceSaver::save(loaded_resource, other_path) == OK);
+	CHECK(saver->get_incremental_reused_blocks(save_path) == -1);
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -167,6 +167,240 @@ TEST_CASE("[String] UTF8 with CR") {
 	CHECK(no_cr == base.replace("\r", ""));
 }
 
+TEST_CASE("[String] UTF8 long strings") {
+	// Exercise the word-at-a-time ASCII path around non-ASCII characters at every offset.
+	const String ascii = "The quick brown fox jumps over the lazy dog.";
+	const String latin1 = U"Les naïfs ægithales hâtifs pondant à Noël où il gèle.";
+	const String cjk = U"天地玄黄宇宙洪荒日月盈昃辰宿列张";
+	for (int i = 0; i < 16; i++) {
+		const String base = ascii.substr(0, i) + latin1 + ascii + cjk + ascii.substr(i) + U"🎤";
+		CharString cs = base.utf8();
+
+		String s;
+		Error err = s.parse_utf8(cs.get_data());
+		CHECK(err == OK);
+		CHECK(s == base);
+
+		int cut = i % 4;
+		ERR_PRINT_OFF
+		err = s.parse_utf8(cs.get_data(), cs.length() - cut);
+		ERR_PRINT_ON
+		CHECK(err == (cut == 0 ? OK : ERR_INVALID_DATA)); // Cut in the middle of the last character.
+		CHECK(s.begins_with(base.substr(0, base.length() - 1)));
+	}
+
+	// Text after a NUL character is ignored, even within the given length.
+	const char nul_str[] = "ABCDEFGHIJ\0KLMNOPQRSTUVWXYZ";
+	String s;
+	CHECK(s.parse_utf8(nul_str, sizeof(nul_str) - 1) == OK);
+	CHECK(s == "ABCDEFGHIJ");
+
+	// CR is skipped inside long ASCII runs.
+	const String crlf = "0123456789\r\n0123456789abcdef\r\n";
+	CHECK(s.parse_utf8(crlf.utf8().get_data(), -1, true) == OK);
+	CHECK(s == "0123456789\n0123456789abcdef\n");
+
+	// Invalid sequences after long ASCII runs are still reported.
+	ERR_PRINT_OFF
+	const char invalid_str[] = "ABCDEFGHIJKLMNOP\xff\x41\x42";
+	CHECK(s.parse_utf8(invalid_str) == ERR_INVALID_DATA);
+	CHECK(s == U"ABCDEFGHIJKLMNOP\uFFFDAB");
+	ERR_PRINT_ON
+}
+
+// Byte at a time UTF-8 decoder, following the same rules as String::parse_utf8() without its ASCII fast path.
+static Error decode_utf8_scalar(const uint8_t *p_utf8, int p_len, bool p_skip_cr, LocalVector<char32_t> &r_decoded) {
+	r_decoded.clear();
+	if (p_len >= 3 && p_utf8[0] == 0xef && p_utf8[1] == 0xbb && p_utf8[2] == 0xbf) {
+		p_utf8 += 3;
+		p_len -= 3;
+	}
+
+	bool decode_error = false;
+	bool decode_failed = false;
+	int skip = 0;
+	uint8_t c_start = 0;
+	uint32_t unichar = 0;
+	for (int i = 0; i < p_len && p_utf8[i]; i++) {
+		const uint8_t c = p_utf8[i];
+		if (skip == 0) {
+			if (p_skip_cr && c == '\r') {
+				continue;
+			}
+			c_start = c;
+			unichar = 0;
+			if ((c & 0x80) == 0) {
+				r_decoded.push_back(c);
+			} else if ((c & 0xe0) == 0xc0) {
+				unichar = c & 0x1f;
+				skip = 1;
+				if ((c & 0x1e) == 0) {
+					decode_error = true; // Overlong.
+				}
+			} else if ((c & 0xf0) == 0xe0) {
+				unichar = c & 0x0f;
+				skip = 2;
+			} else if ((c & 0xf8) == 0xf0) {
+				unichar = c & 0x07;
+				skip = 3;
+			} else if ((c & 0xfc) == 0xf8) {
+				unichar = c & 0x03;
+				skip = 4;
+			} else if ((c & 0xfe) == 0xfc) {
+				unichar = c & 0x01;
+				skip = 5;
+			} else {
+				r_decoded.push_back(0xfffd);
+				decode_failed = true;
+			}
+		} else {
+			if ((c_start == 0xe0 && skip == 2 && c < 0xa0) || (c_start == 0xf0 && skip == 3 && c < 0x90) || (c_start == 0xf8 && skip == 4 && c < 0x88) || (c_start == 0xfc && skip == 5 && c < 0x84)) {
+				decode_error = true; // Overlong.
+			}
+			if (c < 0x80 || c > 0xbf) {
+				// The byte is consumed, not decoded again as a leading byte.
+				r_decoded.push_back(0xfffd);
+				decode_failed = true;
+				skip = 0;
+			} else {
+				unichar = (unichar << 6) | (c & 0x3f);
+				skip--;
+				if (skip == 0) {
+					if (unichar == 0 || (unichar & 0xfffff800) == 0xd800 || unichar > 0x10ffff) {
+						decode_failed = true;
+						unichar = 0xfffd;
+					}
+					r_decoded.push_back(unichar);
+				}
+			}
+		}
+	}
+	if (skip) {
+		r_decoded.push_back(0x20);
+		decode_failed = true;
+	}
+
+	return decode_failed ? ERR_INVALID_DATA : (decode_error ? ERR_PARSE_ERROR : OK);
+}
+
+// Code point at a time UTF-8 encoder, following the same rules as String::utf8() without its ASCII fast path.
+static void encode_utf8_scalar(const char32_t *p_str, int p_len, LocalVector<uint8_t> &r_encoded) {
+	r_encoded.clear();
+	for (int i = 0; i < p_len; i++) {
+		const uint32_t c = p_str[i];
+		int extra = 0;
+		if (c <= 0x7f) {
+			r_encoded.push_back(c);
+			continue;
+		} else if (c <= 0x7ff) {
+			r_encoded.push_back(0xc0 | (c >> 6));
+			extra = 1;
+		} else if (c <= 0xffff) {
+			r_encoded.push_back(0xe0 | (c >> 12));
+			extra = 2;
+		} else if (c <= 0x1fffff) {
+			r_encoded.push_back(0xf0 | (c >> 18));
+			extra = 3;
+		} else if (c <= 0x3ffffff) {
+			r_encoded.push_back(0xf8 | (c >> 24));
+			extra = 4;
+		} else {
+			r_encoded.push_back(0xfc | ((c >> 30) & 0x01));
+			extra = 5;
+		}
+		for (int j = extra - 1; j >= 0; j--) {
+			r_encoded.push_back(0x80 | ((c >> (j * 6)) & 0x3f));
+		}
+	}
+}
+
+TEST_CASE("[String] UTF8 fast paths match the scalar decoder and encoder") {
+	// Pieces of valid and invalid UTF-8, joined at random so that they fall on every position
+	// relative to the 8 byte ASCII blocks, including sequences split across block boundaries.
+	static const char *pieces[] = {
+		"\xc3\xa9", // Valid 2 bytes.
+		"\xe6\x97\xa5", // Valid 3 bytes.
+		"\xf0\x9f\x8e\xa4", // Valid 4 bytes.
+		"\xc0\x80", // Overlong NUL.
+		"\xc1\xbf", // Overlong 2 bytes.
+		"\xe0\x80\xaf", // Overlong 3 bytes.
+		"\xf0\x82\x82\xac", // Overlong 4 bytes.
+		"\xed\xa0\x80", // Lead surrogate.
+		"\xed\xbf\xbf", // Trail surrogate.
+		"\xf4\x90\x80\x80", // Above U+10FFFF.
+		"\xf8\x88\x80\x80\x80", // 5 bytes.
+		"\xfc\x84\x80\x80\x80\x80", // 6 bytes.
+		"\xfe", // Invalid leading byte.
+		"\xff",
+		"\x80", // Stray continuation byte.
+		"\xbf\xbf",
+		"\xe6\x97", // Missing continuation byte.
+		"\xf0\x9f",
+		"\xc3", // Missing continuation byte, followed by ASCII.
+		"\r",
+		"\r\n",
+	};
+	const int piece_count = sizeof(pieces) / sizeof(pieces[0]);
+
+	uint32_t seed = 20241018;
+	LocalVector<uint8_t> bytes;
+	LocalVector<char32_t> expected;
+	LocalVector<uint8_t> encoded;
+	bool all_match = true;
+	ERR_PRINT_OFF
+	for (int iteration = 0; iteration < 2000 && all_match; iteration++) {
+		bytes.clear();
+		seed = seed * 1103515245 + 12345;
+		const int piece_total = (seed >> 16) % 12;
+		for (int i = 0; i < piece_total; i++) {
+			seed = seed * 1103515245 + 12345;
+			const int ascii_run = (seed >> 8) % 20;
+			for (int j = 0; j < ascii_run; j++) {
+				bytes.push_back('a' + (j + i) % 26);
+			}
+			seed = seed * 1103515245 + 12345;
+			const char *piece = pieces[(seed >> 16) % piece_count];
+			for (const char *c = piece; *c; c++) {
+				bytes.push_back(*c);
+			}
+		}
+		seed = seed * 1103515245 + 12345;
+		if ((seed >> 16) % 16 == 0 && bytes.size() > 0) {
+			bytes[(seed >> 4) % bytes.size()] = 0; // Decoding stops at a NUL byte.
+		}
+		if ((seed >> 20) % 16 == 0) {
+			bytes.insert(0, 0xef);
+			bytes.insert(1, 0xbb);
+			bytes.insert(2, 0xbf);
+		}
+		const bool skip_cr = (seed >> 24) % 2 == 0;
+		const int len = bytes.size();
+		bytes.push_back(0);
+
+		// Decoding with an explicit length and with a NUL-terminated string.
+		const Error expected_error = decode_utf8_scalar(bytes.ptr(), len, skip_cr, expected);
+		expected.push_back(0);
+		for (int terminated = 0; terminated < 2; terminated++) {
+			String s;
+			const Error err = s.parse_utf8((const char *)bytes.ptr(), terminated ? -1 : len, skip_cr);
+			all_match = all_match && err == expected_error && s == expected.ptr();
+		}
+
+		// Encoding what was decoded, including code points that aren't valid Unicode.
+		String s = expected.ptr();
+		seed = seed * 1103515245 + 12345;
+		if (s.length() > 0 && (seed >> 16) % 4 == 0) {
+			const char32_t invalid[] = { 0xd800, 0xdfff, 0x110000, 0x3ffffff, 0x7fffffff };
+			s.set((seed >> 4) % s.length(), invalid[(seed >> 8) % 5]);
+		}
+		encode_utf8_scalar(s.get_data(), s.length(), encoded);
+		const CharString cs = s.utf8();
+		all_match = all_match && cs.length() == (int)encoded.size() && memcmp(cs.get_data(), encoded.ptr(), encoded.size()) == 0;
+	}
+	ERR_PRINT_ON
+	CHECK_MESSAGE(all_match, "UTF-8 decoding and encoding should match the scalar implementation.");
+}
+
 TEST_CASE("[String] Invalid UTF8 (non-standard)") {
 	ERR_PRINT_OFF
 	static const uint8_t u8str[] = { 0x45, 0xE3, 0x81, 0x8A, 0xE3, 0x82, 0x88, 0xE3, 0x81, 0x86, 0xF0, 0x9F, 0x8E, 0xA4, 0xF0, 0x82, 0x82, 0xAC, 0xED, 0xA0, 0x81, 0 };
@@ -390,6 +624,47 @@ TEST_CASE("[String] Find and replace") {
 	CHECK(s == "Wappy Halloween, Anna!");
 }
 
+TEST_CASE("[String] Find, count, split and replace in long strings") {
+	// Log-like text with near matches of the keys, to exercise first/last character filtering.
+	String line = U"time=%d level=info msg=\"naïve request\" path=/api/v1/item,id=%d,status=ok\n";
+	String text;
+	const int line_count = 2000;
+	for (int i = 0; i < line_count; i++) {
+		text += line.replace("%d", itos(i));
+	}
+	text += "level=warn";
+
+	CHECK(text.find("level=warn") == text.length() - 10);
+	CHECK(text.find("level=warm") == -1);
+	CHECK(text.rfind("level=info") == text.rfind("time=1999") + 10);
+	CHECK(text.findn("LEVEL=WARN") == text.length() - 10);
+	CHECK(text.rfindn("NAÏVE") == text.rfind(U"naïve"));
+	CHECK(text.count("status=ok") == line_count);
+	CHECK(text.countn("STATUS=OK") == line_count);
+	CHECK(text.count("status=ok", text.find("time=1000")) == line_count - 1000);
+	CHECK(text.count("status=ok", 0, text.find("time=1000")) == 1000);
+	CHECK(text.count("=") == line_count * 6 + 1);
+
+	Vector<String> lines = text.split("\n");
+	CHECK(lines.size() == line_count + 1);
+	CHECK(lines[1234] == U"time=1234 level=info msg=\"naïve request\" path=/api/v1/item,id=1234,status=ok");
+	CHECK(lines[line_count] == "level=warn");
+	CHECK(text.split("\n", true, 10).size() == 11);
+	CHECK(lines[42].split(",").size() == 3);
+	CHECK(lines[42].split("=", false).size() == 7);
+	CHECK(String(",a,,b,").split(",").size() == 5);
+	CHECK(String(",a,,b,").split(",")[2].is_empty());
+	CHECK(String(",a,,b,").split(",", false).size() == 2);
+
+	String replaced = text.replace("level=info", "lvl=i");
+	CHECK(replaced.length() == text.length() - line_count * 5);
+	CHECK(replaced.count("lvl=i") == line_count);
+	CHECK(replaced.replace("lvl=i", "level=info") == text);
+	CHECK(text.replace(",", "") == text.replace(",", String()));
+	CHECK(text.replace("not present", "x") == text);
+	CHECK(text.replacen("LEVEL=WARN", "level=error").ends_with("level=error"));
+}
+
 TEST_CASE("[String] Insertion") {
 	String s = "Who is Frederic?";
 	s = s.insert(s.find("?"), " Chopin");
@@ -0,0 +1,207 @@
+/**************************************************************************/
+/*  test_block_vector.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BLOCK_VECTOR_H
+#define TEST_BLOCK_VECTOR_H
+
+#include "core/templates/block_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBlockVector {
+
+TEST_CASE("[BlockVector] Push back and index") {
+	BlockVector<int, 4> vector;
+	for (int i = 0; i < 100; i++) {
+		vector.push_back(i);
+	}
+
+	CHECK(vector.size() == 100);
+	for (int i = 0; i < 100; i++) {
+		CHECK(vector[i] == i);
+	}
+	// Out of order access.
+	CHECK(vector[73] == 73);
+	CHECK(vector[2] == 2);
+	CHECK(vector[99] == 99);
+}
+
+TEST_CASE("[BlockVector] Insert") {
+	BlockVector<int, 4> vector;
+	for (int i = 0; i < 20; i++) {
+		vector.push_back(i * 2);
+	}
+	for (int i = 0; i < 20; i++) {
+		vector.insert(i * 2 + 1, i * 2 + 1);
+	}
+	vector.insert(0, -1);
+
+	CHECK(vector.size() == 41);
+	for (int i = 0; i < 41; i++) {
+		CHECK(vector[i] == i - 1);
+	}
+}
+
+TEST_CASE("[BlockVector] Remove") {
+	BlockVector<int, 4> vector;
+	for (int i = 0; i < 50; i++) {
+		vector.push_back(i);
+	}
+
+	vector.remove_at(0);
+	vector.remove_at(48);
+	CHECK(vector.size() == 48);
+	CHECK(vector[0] == 1);
+	CHECK(vector[47] == 48);
+
+	// Spans several blocks.
+	vector.remove_range(5, 40);
+	CHECK(vector.size() == 13);
+	for (int i = 0; i < 5; i++) {
+		CHECK(vector[i] == i + 1);
+	}
+	for (int i = 5; i < 13; i++) {
+		CHECK(vector[i] == i + 36);
+	}
+
+	vector.remove_range(0, vector.size());
+	CHECK(vector.is_empty());
+	vector.push_back(7);
+	CHECK(vector[0] == 7);
+}
+
+TEST_CASE("[BlockVector] Iterate and copy") {
+	BlockVector<String, 4> vector;
+	for (int i = 0; i < 30; i++) {
+		vector.push_back(itos(i));
+	}
+	vector.remove_range(10, 20);
+
+	int count = 0;
+	for (String &E : vector) {
+		E += "!";
+		count++;
+	}
+	CHECK(count == 20);
+
+	BlockVector<String, 4> copy = vector;
+	vector.clear();
+	CHECK(vector.size() == 0);
+	CHECK(copy.size() == 20);
+	CHECK(copy[9] == "9!");
+	CHECK(copy[10] == "20!");
+
+	count = 0;
+	for (const String &E : copy) {
+		CHECK(E.ends_with("!"));
+		count++;
+	}
+	CHECK(count == 20);
+}
+
+TEST_CASE("[BlockVector] Random edits") {
+	BlockVector<int, 8> vector;
+	LocalVector<int> expected;
+	uint32_t seed = 1234;
+	for (int i = 0; i < 2000; i++) {
+		seed = seed * 1103515245 + 12345;
+		const uint32_t r = seed >> 8;
+		if (expected.is_empty() || r % 3 != 0) {
+			const uint32_t at = r % (expected.size() + 1);
+			vector.insert(at, i);
+			expected.insert(at, i);
+		} else if (r % 2 == 0) {
+			const uint32_t at = r % expected.size();
+			vector.remove_at(at);
+			expected.remove_at(at);
+		} else {
+			const uint32_t from = r % expected.size();
+			const uint32_t to = MIN(from + (r >> 12) % 20, expected.size());
+			vector.remove_range(from, to);
+			for (uint32_t j = from; j < to; j++) {
+				expected.remove_at(from);
+			}
+		}
+	}
+
+	REQUIRE(vector.size() == expected.size());
+	bool matches = true;
+	for (uint32_t i = 0; i < expected.size(); i++) {
+		matches = matches && vector[i] == expected[i];
+	}
+	CHECK(matches);
+}
+
+TEST_CASE("[BlockVector] Shrinking merges blocks") {
+	BlockVector<int, 16> vector;
+	LocalVector<int> expected;
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+		expected.push_back(i);
+	}
+
+	// Removing most elements everywhere leaves small blocks, which must be merged with their neighbours.
+	uint32_t seed = 4321;
+	while (expected.size() > 10) {
+		seed = seed * 1103515245 + 12345;
+		const uint32_t at = (seed >> 8) % expected.size();
+		if ((seed >> 4) % 4 == 0) {
+			const uint32_t to = MIN(at + 7, expected.size());
+			vector.remove_range(at, to);
+			for (uint32_t j = at; j < to; j++) {
+				expected.remove_at(at);
+			}
+		} else {
+			vector.remove_at(at);
+			expected.remove_at(at);
+		}
+
+		bool matches = vector.size() == expected.size();
+		for (uint32_t i = 0; i < expected.size() && matches; i += 17) {
+			matches = vector[i] == expected[i];
+		}
+		REQUIRE(matches);
+	}
+
+	int index = 0;
+	for (const int &E : vector) {
+		CHECK(E == expected[index]);
+		index++;
+	}
+	CHECK(index == (int)expected.size());
+	for (int i = expected.size() - 1; i >= 0; i--) {
+		CHECK(vector[i] == expected[i]);
+	}
+}
+
+} // namespace TestBlockVector
+
+#endif // TEST_BLOCK_VECTOR_H
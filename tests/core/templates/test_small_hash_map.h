@@ -0,0 +1,208 @@
+/**************************************************************************/
+/*  test_small_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef TEST_SMALL_HASH_MAP_H
+#define TEST_SMALL_HASH_MAP_H
+
+#include "core/templates/small_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSmallHashMap {
+
+TEST_CASE("[SmallHashMap] Insert element") {
+	SmallHashMap<int, int> map;
+	map.insert(42, 84);
+
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.getptr(42) != nullptr);
+	CHECK(map.getptr(43) == nullptr);
+}
+
+TEST_CASE("[SmallHashMap] Overwrite element") {
+	SmallHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[SmallHashMap] Erase keeps insertion order") {
+	SmallHashMap<int, int> map;
+	map.insert(1, 10);
+	map.insert(2, 20);
+	map.insert(3, 30);
+
+	CHECK(map.erase(2));
+	CHECK_FALSE(map.erase(2));
+	CHECK(map.size() == 2);
+	CHECK(map.get_by_index(0).key == 1);
+	CHECK(map.get_by_index(1).key == 3);
+	CHECK(map[3] == 30);
+}
+
+TEST_CASE("[SmallHashMap] Replace key keeps position") {
+	SmallHashMap<String, int> map;
+	map.insert("a", 1);
+	map.insert("b", 2);
+	map.insert("c", 3);
+
+	CHECK(map.replace_key("b", "z"));
+	CHECK_FALSE(map.has("b"));
+	CHECK(map.find_index("z") == 1);
+	CHECK(map["z"] == 2);
+}
+
+TEST_CASE("[SmallHashMap] Iteration") {
+	SmallHashMap<int, int> map;
+	for (int i = 0; i < 5; i++) {
+		map.insert(i * 3, i);
+	}
+
+	int expected = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected * 3);
+		CHECK(E.value == expected);
+		expected++;
+	}
+	CHECK(expected == 5);
+}
+
+TEST_CASE("[SmallHashMap] Growing past the index threshold") {
+	SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i * 2);
+	}
+
+	CHECK(map.size() == 100);
+	for (int i = 0; i < 100; i++) {
+		CHECK(map.find_index(i) == i);
+		CHECK(map[i] == i * 2);
+	}
+
+	// Erasing must keep lookups in sync with the shifted elements.
+	for (int i = 0; i < 100; i += 2) {
+		CHECK(map.erase(i));
+	}
+	CHECK(map.size() == 50);
+	for (int i = 1; i < 100; i += 2) {
+		CHECK(map.find_index(i) == i / 2);
+		CHECK(map[i] == i * 2);
+	}
+	CHECK_FALSE(map.has(0));
+
+	CHECK(map.replace_key(1, 1000));
+	CHECK(map.find_index(1000) == 0);
+	CHECK_FALSE(map.has(1));
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK_FALSE(map.has(3));
+}
+
+TEST_CASE("[SmallHashMap] Erasing from a large map keeps insertion order") {
+	SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i, i);
+	}
+
+	// Leaves tombstones behind, without compacting yet.
+	CHECK(map.erase(2));
+	CHECK(map.erase(5));
+	CHECK(map.size() == 8);
+	CHECK(map.find_index(6) == 4);
+	CHECK(map.get_by_index(4).key == 6);
+
+	int expected[] = { 0, 1, 3, 4, 6, 7, 8, 9 };
+	int i = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected[i]);
+		i++;
+	}
+	CHECK(i == 8);
+
+	i = 7;
+	for (SmallHashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, 4>::Iterator I = map.last(); I; --I) {
+		CHECK(I->key == expected[i]);
+		i--;
+	}
+	CHECK(i == -1);
+
+	// Inserting after tombstones appends at the end.
+	map.insert(2, 20);
+	CHECK(map.find_index(2) == 8);
+	CHECK(map.last()->key == 2);
+
+	// Erasing from the back drops the trailing tombstones.
+	for (int j = 0; j < 10; j++) {
+		map.erase(j);
+	}
+	CHECK(map.is_empty());
+	CHECK_FALSE(map.last());
+	CHECK(map.begin() == map.end());
+
+	// Erasing most elements compacts, lookups must follow.
+	for (int j = 0; j < 100; j++) {
+		map.insert(j, j * 2);
+	}
+	for (int j = 0; j < 100; j++) {
+		if (j % 10 != 0) {
+			CHECK(map.erase(j));
+		}
+	}
+	CHECK(map.size() == 10);
+	for (int j = 0; j < 100; j += 10) {
+		CHECK(map.find_index(j) == j / 10);
+		CHECK(map[j] == j * 2);
+	}
+}
+
+TEST_CASE("[SmallHashMap] Copy") {
+	SmallHashMap<String, int> map;
+	map.insert("a", 1);
+	map.insert("b", 2);
+
+	SmallHashMap<String, int> copy = map;
+	copy.insert("c", 3);
+	map.erase("a");
+
+	CHECK(copy.size() == 3);
+	CHECK(copy["a"] == 1);
+	CHECK(map.size() == 1);
+}
+
+} // namespace TestSmallHashMap
+
+#endif // TEST_SMALL_HASH_MAP_H
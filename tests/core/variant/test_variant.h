@@ -32,6 +32,9 @@
 #ifndef TEST_VARIANT_H
 #define TEST_VARIANT_H
 
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -1727,6 +1730,149 @@ TEST_CASE("[Variant] Writer and parser dictionary") {
 	CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
 }
 
+static Error parse_variant_string(const String &p_string, Variant &r_value, String &r_err_str, int &r_line) {
+	VariantParser::StreamString ss;
+	ss.s = p_string;
+	r_line = 1;
+	return VariantParser::parse(&ss, r_value, r_err_str, r_line);
+}
+
+TEST_CASE("[Variant] Writer and parser packed arrays and strings") {
+	// Values are chosen to be written without losing precision, so they parse back exactly.
+	PackedFloat32Array floats;
+	PackedVector2Array points;
+	PackedInt32Array ints;
+	for (int i = 0; i < 2000; i++) {
+		floats.push_back((i % 1000) * 0.25f - 100.0f);
+		points.push_back(Vector2((i % 4000) * 0.5f, -(i % 64) * 0.125f));
+		ints.push_back(i * (i % 2 ? 1 : -3));
+	}
+	PackedFloat64Array doubles = { 0.0, -1.5, 0.015625, 3.25e10 };
+	PackedInt64Array longs = { INT64_MAX, INT64_MIN + 1, 0 };
+	PackedByteArray bytes = { 0, 7, 255 };
+	PackedColorArray colors = { Color(0.1, 0.2, 0.3, 0.4), Color(1, 1, 1) };
+
+	Dictionary d = build_dictionary(
+			String("floats"), floats,
+			String("points"), points,
+			String("ints"), ints,
+			String("doubles"), doubles,
+			String("longs"), longs,
+			String("bytes"), bytes,
+			String("colors"), colors,
+			String("text"), String(U"naïve \"日本\"\n\\tab\t€"),
+			String("name"), StringName("some_name"),
+			String("xform"), Transform3D(Basis::from_scale(Vector3(2, 0.5, -1)), Vector3(1, -2, 3e5)));
+	String d_str;
+	VariantWriter::write_to_string(d, d_str);
+
+	SUBCASE("From a String") {
+		String errs;
+		int line;
+		Variant d_parsed;
+
+		CHECK(parse_variant_string(d_str, d_parsed, errs, line) == OK);
+		CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
+
+		String d_parsed_str;
+		VariantWriter::write_to_string(d_parsed, d_parsed_str);
+		CHECK_MESSAGE(d_parsed_str == d_str, "Should be written back the same way.");
+	}
+
+	SUBCASE("From a UTF-8 file") {
+		const String path = OS::get_singleton()->get_cache_path().path_join("variant_parser.txt");
+		{
+			Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+			REQUIRE(f.is_valid());
+			f->store_string(d_str);
+		}
+
+		VariantParser::StreamFile sf;
+		sf.f = FileAccess::open(path, FileAccess::READ);
+		REQUIRE(sf.f.is_valid());
+		String errs;
+		int line = 1;
+		Variant d_parsed;
+
+		CHECK(VariantParser::parse(&sf, d_parsed, errs, line) == OK);
+		CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
+		CHECK(line == d_str.count("\n") + 1);
+
+		sf.f.unref();
+		DirAccess::remove_absolute(path);
+	}
+
+	SUBCASE("Escaped characters from a UTF-8 file") {
+		// Strings from UTF-8 streams used to be built as a String, then converted with ascii(true) and decoded with
+		// parse_utf8(): NUL characters are dropped and characters above 0xFF become spaces, both with errors.
+		const String sources[] = {
+			"\"a\\u0000b\"",
+			"\"x\\u0100y\\u20ACz\"",
+			"\"\\u00c3\\u00a9t\\u00e9\"",
+			"\"plain text\"",
+		};
+		const String path = OS::get_singleton()->get_cache_path().path_join("variant_parser_escapes.txt");
+		Vector<String> results;
+		for (const String &source : sources) {
+			String errs;
+			int line;
+			Variant from_string;
+			ERR_PRINT_OFF;
+			CHECK(parse_variant_string(source, from_string, errs, line) == OK);
+			String expected;
+			expected.parse_utf8(String(from_string).ascii(true).get_data());
+			ERR_PRINT_ON;
+
+			{
+				Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+				REQUIRE(f.is_valid());
+				f->store_string(source);
+			}
+			VariantParser::StreamFile sf;
+			sf.f = FileAccess::open(path, FileAccess::READ);
+			REQUIRE(sf.f.is_valid());
+			line = 1;
+			Variant from_file;
+			ERR_PRINT_OFF;
+			CHECK(VariantParser::parse(&sf, from_file, errs, line) == OK);
+			ERR_PRINT_ON;
+			CHECK_MESSAGE(String(from_file) == expected, vformat("Escapes in %s should be decoded as before.", source));
+			results.push_back(from_file);
+		}
+		CHECK(results[0] == "ab");
+		CHECK(results[1] == "x y z");
+		DirAccess::remove_absolute(path);
+	}
+
+	SUBCASE("Comments, special values and errors") {
+		String errs;
+		int line;
+		Variant parsed;
+
+		CHECK(parse_variant_string("PackedFloat32Array( 1 ,\n-2.5e1 ; comment\n, inf, inf_neg, nan )", parsed, errs, line) == OK);
+		CHECK(line == 3);
+		PackedFloat32Array values = parsed;
+		REQUIRE(values.size() == 5);
+		CHECK(values[0] == 1);
+		CHECK(values[1] == -25);
+		CHECK(values[2] == INFINITY);
+		CHECK(values[3] == -INFINITY);
+		CHECK(Math::is_nan(values[4]));
+
+		CHECK(parse_variant_string("PackedInt32Array()", parsed, errs, line) == OK);
+		CHECK(PackedInt32Array(parsed).is_empty());
+
+		CHECK(parse_variant_string("Vector2i(-3, 4.75)", parsed, errs, line) == OK);
+		CHECK(parsed == Variant(Vector2i(-3, 4)));
+
+		CHECK(parse_variant_string("PackedFloat32Array(1, true)", parsed, errs, line) == ERR_PARSE_ERROR);
+		CHECK(errs == "Expected float in constructor");
+
+		CHECK(parse_variant_string("Vector2(1 2)", parsed, errs, line) == ERR_PARSE_ERROR);
+		CHECK(errs == "Expected ',' or ')' in constructor");
+	}
+}
+
 TEST_CASE("[Variant] Writer recursive dictionary") {
 	// There is no way to accurately represent a recursive dictionary,
 	// the only thing we can do is make sure the writer doesn't blow up
@@ -32,6 +32,8 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "core/object/message_queue.h"
+#include "scene/gui/box_container.h"
 #include "scene/gui/control.h"
 
 #include "tests/test_macros.h"
@@ -62,6 +64,41 @@ TEST_CASE("[SceneTree][Control]") {
 	}
 }
 
+static int sort_count = 0;
+
+static void _count_sort() {
+	sort_count++;
+}
+
+TEST_CASE("[SceneTree][Control] Layout of nested containers") {
+	VBoxContainer *root = memnew(VBoxContainer);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	root->connect(SceneStringName(sort_children), callable_mp_static(_count_sort));
+
+	Container *parent = root;
+	for (int i = 0; i < 8; i++) {
+		VBoxContainer *container = memnew(VBoxContainer);
+		container->connect(SceneStringName(sort_children), callable_mp_static(_count_sort));
+		parent->add_child(container);
+		parent = container;
+	}
+
+	Control *leaf = memnew(Control);
+	parent->add_child(leaf);
+	MessageQueue::get_singleton()->flush();
+
+	sort_count = 0;
+	leaf->set_custom_minimum_size(Size2(40, 30));
+	MessageQueue::get_singleton()->flush();
+
+	CHECK(root->get_combined_minimum_size() == Size2(40, 30));
+	CHECK(leaf->get_size() == Size2(40, 30));
+	// Minimum sizes are resolved before any container is sorted, so each one is sorted once.
+	CHECK(sort_count == 9);
+
+	memdelete(root);
+}
+
 } // namespace TestControl
 
 #endif // TEST_CONTROL_H
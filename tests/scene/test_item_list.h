@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  test_item_list.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_ITEM_LIST_H
+#define TEST_ITEM_LIST_H
+
+#include "core/object/message_queue.h"
+#include "scene/gui/item_list.h"
+
+#include "tests/test_macros.h"
+
+namespace TestItemList {
+
+static int icon_requests = 0;
+
+static void _provide_icon(int p_idx) {
+	icon_requests++;
+}
+
+static ItemList *icon_item_list = nullptr;
+static Vector<int> icon_request_indices;
+
+static void _provide_icon_and_remove(int p_idx) {
+	icon_request_indices.push_back(p_idx);
+	if (icon_request_indices.size() == 1) {
+		// Shifts the items whose requests are still queued.
+		icon_item_list->remove_item(p_idx);
+	}
+}
+
+TEST_CASE("[SceneTree][ItemList] Item layout") {
+	ItemList *item_list = memnew(ItemList);
+	SceneTree::get_singleton()->get_root()->add_child(item_list);
+	item_list->set_size(Size2(400, 400));
+
+	SUBCASE("[ItemList] Text changes are measured on the next layout") {
+		item_list->add_item("a");
+		item_list->force_update_list_size();
+		float short_width = item_list->get_item_rect(0).size.x;
+
+		item_list->set_item_text(0, "a much longer item text");
+		item_list->force_update_list_size();
+		CHECK(item_list->get_item_rect(0).size.x > short_width);
+	}
+
+	SUBCASE("[ItemList] Uniform text size") {
+		item_list->set_fixed_column_width(100);
+		item_list->set_uniform_text_size(true);
+		for (int i = 0; i < 1000; i++) {
+			item_list->add_item(i % 2 ? "short" : "a somewhat longer item text");
+		}
+		item_list->force_update_list_size();
+
+		Rect2 first = item_list->get_item_rect(0);
+		CHECK(first.size.y > 0);
+		CHECK(item_list->get_item_rect(1).size == first.size);
+		CHECK(item_list->get_item_rect(999).size == first.size);
+		CHECK(item_list->get_item_rect(1).position.y > first.position.y);
+	}
+
+	SUBCASE("[ItemList] Space is reserved for provided icons") {
+		item_list->set_fixed_icon_size(Size2i(64, 64));
+		item_list->add_item("");
+		item_list->force_update_list_size();
+		float height = item_list->get_item_rect(0).size.y;
+		CHECK(height < 64);
+
+		icon_requests = 0;
+		item_list->set_icon_provider(callable_mp_static(_provide_icon));
+		CHECK(item_list->get_icon_provider().is_valid());
+		item_list->force_update_list_size();
+		CHECK(item_list->get_item_rect(0).size.y >= 64);
+		// Icons are only requested when items are drawn.
+		CHECK(icon_requests == 0);
+	}
+
+	SUBCASE("[ItemList] Icon requests follow their items") {
+		item_list->add_item("a");
+		item_list->add_item("b");
+		icon_item_list = item_list;
+		icon_request_indices.clear();
+		item_list->set_icon_provider(callable_mp_static(_provide_icon_and_remove));
+
+		// Draws the items, which queues the icon requests.
+		MessageQueue::get_singleton()->flush();
+
+		REQUIRE(icon_request_indices.size() == 2);
+		CHECK(icon_request_indices[0] == 0);
+		// "b" moved to index 0 when "a" was removed by the first request.
+		CHECK(icon_request_indices[1] == 0);
+		CHECK(item_list->get_item_count() == 1);
+		CHECK(item_list->get_item_text(0) == "b");
+		icon_item_list = nullptr;
+	}
+
+	memdelete(item_list);
+}
+
+} // namespace TestItemList
+
+#endif // TEST_ITEM_LIST_H
@@ -55,6 +55,10 @@ protected:
 			case NOTIFICATION_PROCESS: {
 				process_counter++;
 				push_self();
+				if (delete_on_process) {
+					memdelete(delete_on_process);
+					delete_on_process = nullptr;
+				}
 			} break;
 			case NOTIFICATION_PHYSICS_PROCESS: {
 				physics_process_counter++;
@@ -77,6 +81,7 @@ public:
 	int physics_process_counter = 0;
 
 	List<Node *> *callback_list = nullptr;
+	Node *delete_on_process = nullptr;
 };
 
 TEST_CASE("[SceneTree][Node] Testing node operations with a very simple scene tree") {
@@ -763,6 +768,152 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+static int process_batch_calls = 0;
+
+static void _test_node_process_batch(Node *const *p_nodes, uint32_t p_count, bool p_physics) {
+	process_batch_calls++;
+	for (uint32_t i = 0; i < p_count; i++) {
+		TestNode *node = static_cast<TestNode *>(p_nodes[i]);
+		if (p_physics) {
+			node->physics_process_counter++;
+		} else {
+			node->process_counter++;
+		}
+	}
+}
+
+TEST_CASE("[SceneTree][Node] Test the batched processing") {
+	TestNode *node = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	TestNode *node2 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node2);
+	TestNode *node3 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node3);
+
+	process_batch_calls = 0;
+	SceneTree::get_singleton()->set_process_batch_callback(TestNode::get_class_static(), &_test_node_process_batch);
+
+	SUBCASE("Process") {
+		node->set_process(true);
+		node2->set_process(true);
+		node3->set_process(true);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(1, process_batch_calls);
+		CHECK_EQ(1, node->process_counter);
+		CHECK_EQ(1, node2->process_counter);
+		CHECK_EQ(1, node3->process_counter);
+	}
+
+	SUBCASE("Physics process") {
+		node->set_physics_process(true);
+		node2->set_physics_process(true);
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(1, process_batch_calls);
+		CHECK_EQ(1, node->physics_process_counter);
+		CHECK_EQ(1, node2->physics_process_counter);
+		CHECK_EQ(0, node3->physics_process_counter);
+	}
+
+	SUBCASE("Removing a node from processing keeps the batch consistent") {
+		node->set_process(true);
+		node2->set_process(true);
+		node3->set_process(true);
+		SceneTree::get_singleton()->process(0);
+
+		node2->set_process(false);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(2, process_batch_calls);
+		CHECK_EQ(2, node->process_counter);
+		CHECK_EQ(1, node2->process_counter);
+		CHECK_EQ(2, node3->process_counter);
+	}
+
+	SUBCASE("Removing the batch callback falls back to notifications") {
+		node->set_process(true);
+		SceneTree::get_singleton()->set_process_batch_callback(TestNode::get_class_static(), nullptr);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(0, process_batch_calls);
+		CHECK_EQ(1, node->process_counter);
+	}
+
+	SceneTree::get_singleton()->set_process_batch_callback(TestNode::get_class_static(), nullptr);
+
+	memdelete(node);
+	memdelete(node2);
+	memdelete(node3);
+}
+
+TEST_CASE("[SceneTree][Node] Test threaded group notifications") {
+	Node *thread_group = memnew(Node);
+	thread_group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	SceneTree::get_singleton()->get_root()->add_child(thread_group);
+
+	TestNode *node = memnew(TestNode);
+	thread_group->add_child(node);
+	node->add_to_group("threaded");
+	TestNode *node2 = memnew(TestNode);
+	thread_group->add_child(node2);
+	node2->add_to_group("threaded");
+	TestNode *node3 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node3);
+	node3->add_to_group("threaded");
+
+	SUBCASE("All nodes are notified once") {
+		SceneTree::get_singleton()->notify_group_flags(SceneTree::GROUP_CALL_THREADED, "threaded", Node::NOTIFICATION_PROCESS);
+
+		CHECK_EQ(1, node->process_counter);
+		CHECK_EQ(1, node2->process_counter);
+		CHECK_EQ(1, node3->process_counter);
+	}
+
+	SUBCASE("Deferred calls ignore the threaded flag") {
+		SceneTree::get_singleton()->notify_group_flags(SceneTree::GROUP_CALL_THREADED | SceneTree::GROUP_CALL_DEFERRED, "threaded", Node::NOTIFICATION_PROCESS);
+		CHECK_EQ(0, node->process_counter);
+
+		MessageQueue::get_singleton()->flush();
+		CHECK_EQ(1, node->process_counter);
+		CHECK_EQ(1, node2->process_counter);
+		CHECK_EQ(1, node3->process_counter);
+	}
+
+	memdelete(node3);
+	memdelete(thread_group);
+}
+
+TEST_CASE("[SceneTree][Node] Test threaded group notifications removing nodes") {
+	Node *thread_group = memnew(Node);
+	thread_group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	SceneTree::get_singleton()->get_root()->add_child(thread_group);
+
+	TestNode *node = memnew(TestNode);
+	thread_group->add_child(node);
+	node->add_to_group("threaded");
+	TestNode *node2 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node2);
+	node2->add_to_group("threaded");
+	TestNode *node3 = memnew(TestNode);
+	SceneTree::get_singleton()->get_root()->add_child(node3);
+	node3->add_to_group("threaded");
+
+	// Both are called on the main thread after the sub-thread group, node3 must be skipped once freed.
+	node2->delete_on_process = node3;
+	SceneTree::get_singleton()->notify_group_flags(SceneTree::GROUP_CALL_THREADED, "threaded", Node::NOTIFICATION_PROCESS);
+
+	CHECK_EQ(1, node->process_counter);
+	CHECK_EQ(1, node2->process_counter);
+	CHECK(node2->delete_on_process == nullptr);
+	List<Node *> group_nodes;
+	SceneTree::get_singleton()->get_nodes_in_group("threaded", &group_nodes);
+	CHECK_EQ(group_nodes.size(), 2);
+
+	memdelete(node2);
+	memdelete(thread_group);
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
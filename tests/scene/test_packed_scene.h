@@ -32,6 +32,7 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -151,6 +152,123 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(10, 20));
+	child->set_z_index(3);
+	child->add_to_group("persistent_group", true);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiating several times must always give the same result.
+	for (int i = 0; i < 3; i++) {
+		Node *instance = packed_scene.instantiate();
+		CHECK(instance != nullptr);
+		CHECK(instance->get_child_count() == 1);
+
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+		CHECK(instance_child != nullptr);
+		CHECK(instance_child->get_name() == "Child");
+		CHECK(instance_child->get_position() == Vector2(10, 20));
+		CHECK(instance_child->get_z_index() == 3);
+		CHECK(instance_child->is_in_group("persistent_group"));
+		CHECK(instance_child->get_owner() == instance);
+
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse data from the previous state.
+	child->set_position(Vector2(-5, 7));
+	packed_scene.pack(scene);
+
+	Node *instance = packed_scene.instantiate();
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+	CHECK(instance_child != nullptr);
+	CHECK(instance_child->get_position() == Vector2(-5, 7));
+	CHECK(instance_child->get_z_index() == 3);
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Pool Instances") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(10, 20));
+	child->add_to_group("persistent_group", true);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	Node *instance = packed_scene->acquire_instance();
+	CHECK(instance != nullptr);
+	Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+	CHECK(instance_child != nullptr);
+
+	SUBCASE("Released instances are reused and reset") {
+		instance_child->set_position(Vector2(-1, -1));
+		instance_child->remove_from_group("persistent_group");
+		instance_child->add_to_group("runtime_group");
+		instance->add_child(memnew(Node));
+
+		packed_scene->release_instance(instance);
+		CHECK(int(packed_scene->get_pool_stats()["pooled_instances"]) == 1);
+		CHECK(int64_t(packed_scene->get_pool_stats()["pooled_snapshot_bytes"]) > 0);
+
+		Node *reused = packed_scene->acquire_instance();
+		CHECK(reused == instance);
+		CHECK(reused->get_child_count() == 1);
+		CHECK(instance_child->get_position() == Vector2(10, 20));
+		CHECK(instance_child->is_in_group("persistent_group"));
+		CHECK_FALSE(instance_child->is_in_group("runtime_group"));
+
+		Dictionary stats = packed_scene->get_pool_stats();
+		CHECK(int(stats["hits"]) == 1);
+		CHECK(int(stats["misses"]) == 1);
+		CHECK(int(stats["pooled_instances"]) == 0);
+		CHECK(int64_t(stats["pooled_snapshot_bytes"]) == 0);
+
+		memdelete(reused);
+	}
+
+	SUBCASE("Instances with missing nodes are not reused") {
+		instance->remove_child(instance_child);
+		memdelete(instance_child);
+
+		packed_scene->release_instance(instance);
+		CHECK(int(packed_scene->get_pool_stats()["pooled_instances"]) == 0);
+
+		Node *other = packed_scene->acquire_instance();
+		CHECK(other != nullptr);
+		CHECK(other->get_child_count() == 1);
+		memdelete(other);
+	}
+
+	SUBCASE("Pool size is limited") {
+		packed_scene->set_pool_max_size(0);
+		packed_scene->release_instance(instance);
+		CHECK(int(packed_scene->get_pool_stats()["pooled_instances"]) == 0);
+	}
+
+	memdelete(scene);
+}
+
 } // namespace TestPackedScene
 
 #endif // TEST_PACKED_SCENE_H
@@ -0,0 +1,81 @@
+/**************************************************************************/
+/*  test_rich_text_label.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#ifndef TEST_RICH_TEXT_LABEL_H
+#define TEST_RICH_TEXT_LABEL_H
+
+#include "scene/gui/rich_text_label.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRichTextLabel {
+
+static RichTextLabel *_create_log(int p_from, int p_to) {
+	RichTextLabel *rtl = memnew(RichTextLabel);
+	SceneTree::get_singleton()->get_root()->add_child(rtl);
+	rtl->set_size(Size2(400, 300));
+	for (int i = p_from; i < p_to; i++) {
+		if (i > p_from) {
+			rtl->add_newline();
+		}
+		rtl->add_text(vformat("Line %d", i));
+	}
+	return rtl;
+}
+
+TEST_CASE("[SceneTree][RichTextLabel] Remove paragraph") {
+	RichTextLabel *rtl = _create_log(0, 50);
+	REQUIRE(rtl->is_ready());
+
+	float content_height = rtl->get_content_height();
+	float first_offset = rtl->get_paragraph_offset(1);
+	float second_offset = rtl->get_paragraph_offset(2);
+
+	CHECK(rtl->remove_paragraph(0));
+	CHECK(rtl->get_paragraph_count() == 49);
+	CHECK(rtl->get_parsed_text().begins_with("Line 1"));
+	CHECK(rtl->get_paragraph_offset(0) == 0);
+	CHECK(rtl->get_paragraph_offset(1) == doctest::Approx(second_offset - first_offset));
+	CHECK(rtl->get_content_height() == doctest::Approx(content_height - first_offset));
+	CHECK(rtl->get_character_paragraph(0) == 0);
+
+	// The remaining layout matches the one of the same text laid out from scratch.
+	RichTextLabel *expected = _create_log(1, 50);
+	CHECK(rtl->get_content_height() == expected->get_content_height());
+	CHECK(rtl->get_paragraph_offset(48) == expected->get_paragraph_offset(48));
+	CHECK(rtl->get_character_paragraph(10) == expected->get_character_paragraph(10));
+
+	memdelete(expected);
+	memdelete(rtl);
+}
+
+} // namespace TestRichTextLabel
+
+#endif // TEST_RICH_TEXT_LABEL_H
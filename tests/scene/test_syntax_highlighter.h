@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  test_syntax_highlighter.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SYNTAX_HIGHLIGHTER_H
+#define TEST_SYNTAX_HIGHLIGHTER_H
+
+#include "scene/gui/code_edit.h"
+#include "scene/resources/syntax_highlighter.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSyntaxHighlighter {
+
+static bool _starts_in_color(const Ref<SyntaxHighlighter> &p_highlighter, int p_line, const Color &p_color) {
+	const Dictionary color_map = p_highlighter->get_line_syntax_highlighting(p_line);
+	if (!color_map.has(0)) {
+		return false;
+	}
+	return Dictionary(color_map[0]).get("color", Color()) == Variant(p_color);
+}
+
+TEST_CASE("[SceneTree][CodeHighlighter] Color regions across edits") {
+	CodeEdit *code_edit = memnew(CodeEdit);
+	SceneTree::get_singleton()->get_root()->add_child(code_edit);
+
+	const Color comment_color = Color(0, 1, 0);
+	Ref<CodeHighlighter> highlighter;
+	highlighter.instantiate();
+	highlighter->add_color_region("/*", "*/", comment_color);
+	code_edit->set_syntax_highlighter(highlighter);
+
+	code_edit->set_text("a\nb\nc\nd\ne");
+	for (int i = 0; i < 5; i++) {
+		CHECK_FALSE(_starts_in_color(highlighter, i, comment_color));
+	}
+
+	SUBCASE("[CodeHighlighter] Opening a region recolors the following lines") {
+		code_edit->set_line(1, "b /*");
+		CHECK_FALSE(_starts_in_color(highlighter, 1, comment_color));
+		CHECK(_starts_in_color(highlighter, 4, comment_color));
+		CHECK(_starts_in_color(highlighter, 2, comment_color));
+
+		code_edit->set_line(3, "*/ d");
+		CHECK(_starts_in_color(highlighter, 3, comment_color));
+		CHECK_FALSE(_starts_in_color(highlighter, 4, comment_color));
+
+		code_edit->set_line(1, "b");
+		CHECK_FALSE(_starts_in_color(highlighter, 2, comment_color));
+		CHECK_FALSE(_starts_in_color(highlighter, 4, comment_color));
+	}
+
+	SUBCASE("[CodeHighlighter] Inserting and removing lines") {
+		code_edit->set_line(0, "/* a");
+		CHECK(_starts_in_color(highlighter, 4, comment_color));
+
+		code_edit->insert_line_at(2, "*/");
+		CHECK(code_edit->get_line_count() == 6);
+		CHECK(_starts_in_color(highlighter, 1, comment_color));
+		CHECK_FALSE(_starts_in_color(highlighter, 3, comment_color));
+		CHECK_FALSE(_starts_in_color(highlighter, 5, comment_color));
+
+		code_edit->remove_text(1, 1, 3, 0);
+		CHECK(code_edit->get_line_count() == 4);
+		CHECK(_starts_in_color(highlighter, 3, comment_color));
+	}
+
+	memdelete(code_edit);
+}
+
+} // namespace TestSyntaxHighlighter
+
+#endif // TEST_SYNTAX_HIGHLIGHTER_H
@@ -32,6 +32,7 @@
 #ifndef TEST_TEXT_EDIT_H
 #define TEST_TEXT_EDIT_H
 
+#include "core/string/string_builder.h"
 #include "scene/gui/text_edit.h"
 
 #include "tests/test_macros.h"
@@ -3578,6 +3579,43 @@ TEST_CASE("[SceneTree][TextEdit] line wrapping") {
 	memdelete(text_edit);
 }
 
+TEST_CASE("[SceneTree][TextEdit] large text") {
+	TextEdit *text_edit = memnew(TextEdit);
+	SceneTree::get_singleton()->get_root()->add_child(text_edit);
+	text_edit->set_size(Size2(800, 200));
+
+	// More lines than are kept shaped, so measuring all of them evicts the first ones.
+	StringBuilder sb;
+	for (int i = 0; i < 6000; i++) {
+		sb.append("line\t" + itos(i) + " lorem ipsum dolor sit amet\n");
+	}
+	text_edit->set_text(sb.as_string());
+	CHECK(text_edit->get_line_count() == 6001);
+
+	const int first_width = text_edit->get_line_width(0);
+	const int last_width = text_edit->get_line_width(5999);
+	CHECK(first_width > 0);
+	CHECK(last_width > first_width);
+
+	for (int i = 0; i < text_edit->get_line_count(); i++) {
+		text_edit->get_line_width(i);
+	}
+	CHECK(text_edit->get_line_width(0) == first_width);
+	CHECK(text_edit->get_line_width(5999) == last_width);
+
+	// Wrapping is still computed for evicted lines.
+	text_edit->set_line(0, "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Donec vasius mattis leo, sed porta ex lacinia bibendum. Nunc bibendum pellentesque.");
+	text_edit->set_line_wrapping_mode(TextEdit::LineWrappingMode::LINE_WRAPPING_BOUNDARY);
+	CHECK(text_edit->get_line_wrap_count(0) == 1);
+	for (int i = 1; i < text_edit->get_line_count(); i++) {
+		text_edit->get_line_wrap_count(i);
+	}
+	CHECK(text_edit->get_line_wrap_count(0) == 1);
+	CHECK(text_edit->get_line_wrap_count(1) == 0);
+
+	memdelete(text_edit);
+}
+
 TEST_CASE("[SceneTree][TextEdit] viewport") {
 	TextEdit *text_edit = memnew(TextEdit);
 	SceneTree::get_singleton()->get_root()->add_child(text_edit);
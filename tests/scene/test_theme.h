@@ -32,9 +32,12 @@
 #ifndef TEST_THEME_H
 #define TEST_THEME_H
 
+#include "scene/gui/control.h"
+#include "scene/main/window.h"
 #include "scene/resources/image_texture.h"
 #include "scene/resources/style_box_flat.h"
 #include "scene/resources/theme.h"
+#include "scene/theme/theme_db.h"
 #include "tests/test_tools.h"
 
 #include "thirdparty/doctest/doctest.h"
@@ -269,6 +272,64 @@ TEST_CASE_FIXTURE(Fixture, "[Theme] Bad theme item names") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[SceneTree][Theme] Theme context item resolution") {
+	Control *control = memnew(Control);
+	SceneTree::get_singleton()->get_root()->add_child(control);
+
+	Ref<Theme> theme;
+	theme.instantiate();
+	theme->set_color("item_color", "ContextType", Color(1, 0, 0));
+	theme->set_color("item_color", "ContextBaseType", Color(0, 1, 0));
+
+	List<Ref<Theme>> themes;
+	themes.push_back(theme);
+	themes.push_back(ThemeDB::get_singleton()->get_default_theme());
+	ThemeContext *context = ThemeDB::get_singleton()->create_theme_context(control, themes);
+	REQUIRE(context != nullptr);
+
+	List<StringName> theme_types;
+	theme_types.push_back("ContextType");
+	theme_types.push_back("ContextBaseType");
+
+	CHECK(context->has_theme_item_in_types(Theme::DATA_TYPE_COLOR, "item_color", theme_types));
+	CHECK(Color(context->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, "item_color", theme_types)) == Color(1, 0, 0));
+	CHECK(control->get_theme_color("item_color", "ContextType") == Color(1, 0, 0));
+	CHECK_FALSE(context->has_theme_item_in_types(Theme::DATA_TYPE_COLOR, "missing_color", theme_types));
+
+	SUBCASE("[Theme] Resolved items follow theme changes") {
+		theme->clear_color("item_color", "ContextType");
+		CHECK(Color(context->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, "item_color", theme_types)) == Color(0, 1, 0));
+
+		theme->set_color("missing_color", "ContextBaseType", Color(0, 0, 1));
+		CHECK(context->has_theme_item_in_types(Theme::DATA_TYPE_COLOR, "missing_color", theme_types));
+	}
+
+	SUBCASE("[Theme] Resolved items depend on the order of theme types") {
+		List<StringName> reversed_types;
+		reversed_types.push_back("ContextBaseType");
+		reversed_types.push_back("ContextType");
+		CHECK(Color(context->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, "item_color", reversed_types)) == Color(0, 1, 0));
+		CHECK(Color(context->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, "item_color", theme_types)) == Color(1, 0, 0));
+
+		List<StringName> base_types;
+		base_types.push_back("ContextBaseType");
+		CHECK(Color(context->get_theme_item_in_types(Theme::DATA_TYPE_COLOR, "item_color", base_types)) == Color(0, 1, 0));
+		CHECK(int(context->get_theme_item_in_types(Theme::DATA_TYPE_CONSTANT, "item_color", theme_types)) == 0);
+	}
+
+	SUBCASE("[Theme] Resolved items follow fallback changes") {
+		int fallback_font_size = ThemeDB::get_singleton()->get_fallback_font_size();
+		CHECK(int(context->get_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, "missing_size", theme_types)) == fallback_font_size);
+
+		ThemeDB::get_singleton()->set_fallback_font_size(fallback_font_size + 7);
+		CHECK(int(context->get_theme_item_in_types(Theme::DATA_TYPE_FONT_SIZE, "missing_size", theme_types)) == fallback_font_size + 7);
+		ThemeDB::get_singleton()->set_fallback_font_size(fallback_font_size);
+	}
+
+	ThemeDB::get_singleton()->destroy_theme_context(control);
+	memdelete(control);
+}
+
 } // namespace TestTheme
 
 #endif // TEST_THEME_H
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  test_tree.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                      GODOT ENGINE - PIXEL ENGINE                       */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Pixel Engine (modified/created files only)  */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TREE_H
+#define TEST_TREE_H
+
+#include "scene/gui/tree.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTree {
+
+static int populate_calls = 0;
+
+static void _populate(TreeItem *p_item) {
+	populate_calls++;
+	for (int i = 0; i < 3; i++) {
+		TreeItem *child = p_item->create_child();
+		child->set_text(0, p_item->get_text(0) + "/" + itos(i));
+		child->set_populate_on_expand(true);
+	}
+}
+
+TEST_CASE("[SceneTree][Tree] Populate on expand") {
+	Tree *tree = memnew(Tree);
+	SceneTree::get_singleton()->get_root()->add_child(tree);
+	tree->set_size(Size2(400, 400));
+	tree->set_populate_callback(callable_mp_static(_populate));
+	populate_calls = 0;
+
+	TreeItem *root = tree->create_item();
+	root->set_text(0, "root");
+	root->set_populate_on_expand(true);
+	CHECK(root->is_collapsed());
+	CHECK(root->get_child_count() == 0);
+
+	SUBCASE("[Tree] Expanding creates the children once") {
+		root->set_collapsed(false);
+		CHECK(populate_calls == 1);
+		CHECK_FALSE(root->is_populate_on_expand());
+		REQUIRE(root->get_child_count() == 3);
+		CHECK(root->get_child(1)->get_text(0) == "root/1");
+
+		// Grandchildren are only created when their parent is expanded.
+		CHECK(root->get_child(0)->get_child_count() == 0);
+		CHECK(root->get_child(0)->is_collapsed());
+
+		root->set_collapsed(true);
+		root->set_collapsed(false);
+		CHECK(populate_calls == 1);
+		CHECK(root->get_child_count() == 3);
+	}
+
+	SUBCASE("[Tree] Keyboard navigation expands") {
+		tree->grab_focus();
+		tree->set_selected(root, 0);
+		SEND_GUI_ACTION("ui_right");
+		CHECK(populate_calls == 1);
+		CHECK_FALSE(root->is_collapsed());
+		CHECK(root->get_child_count() == 3);
+
+		SEND_GUI_ACTION("ui_down");
+		CHECK(tree->get_selected() == root->get_child(0));
+		SEND_GUI_ACTION("ui_right");
+		CHECK(populate_calls == 2);
+		CHECK(root->get_child(0)->get_child_count() == 3);
+	}
+
+	SUBCASE("[Tree] Recursive expansion doesn't populate descendants") {
+		root->set_collapsed_recursive(false);
+		CHECK(populate_calls == 1);
+		REQUIRE(root->get_child_count() == 3);
+		CHECK(root->get_child(0)->is_collapsed());
+		CHECK(root->get_child(0)->is_populate_on_expand());
+		CHECK(root->get_child(0)->get_child_count() == 0);
+	}
+
+	SUBCASE("[Tree] No callback") {
+		tree->set_populate_callback(Callable());
+		root->set_collapsed(false);
+		CHECK(populate_calls == 0);
+		CHECK(root->get_child_count() == 0);
+		CHECK_FALSE(root->is_populate_on_expand());
+	}
+
+	memdelete(tree);
+}
+
+} // namespace TestTree
+
+#endif // TEST_TREE_H
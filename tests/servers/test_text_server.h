@@ -58,6 +58,39 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Pre-rendering glyph ranges") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+					continue;
+				}
+
+				RID font_range = ts->create_font();
+				ts->font_set_data_ptr(font_range, _font_DroidSansFallback, _font_DroidSansFallback_size);
+				RID font_single = ts->create_font();
+				ts->font_set_data_ptr(font_single, _font_DroidSansFallback, _font_DroidSansFallback_size);
+
+				// 5,000 CJK ideographs, well above the batch size, so they're always rasterized on worker threads.
+				const Vector2i size = Vector2i(16, 0);
+				ts->font_render_range(font_range, size, 0x4e00, 0x4e00 + 4999);
+				CHECK(ts->font_get_texture_count(font_range, size) > 0);
+
+				// Glyphs rendered in batch must match glyphs rendered one by one.
+				for (int64_t c = 0x4e00; c < 0x4e00 + 5000; c += 50) {
+					int64_t glyph = ts->font_get_glyph_index(font_single, 16, c, 0);
+					ts->font_render_glyph(font_single, size, glyph);
+					CHECK(ts->font_get_glyph_size(font_range, size, glyph) == ts->font_get_glyph_size(font_single, size, glyph));
+					CHECK(ts->font_get_glyph_offset(font_range, size, glyph) == ts->font_get_glyph_offset(font_single, size, glyph));
+					CHECK(ts->font_get_glyph_advance(font_range, 16, glyph) == ts->font_get_glyph_advance(font_single, 16, glyph));
+				}
+
+				ts->free_rid(font_range);
+				ts->free_rid(font_single);
+			}
+		}
+
 		SUBCASE("[TextServer] Text layout: Font fallback") {
 			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
 				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);